@@ -0,0 +1,59 @@
+#include "shortjson_impl.h"
+
+namespace shortjson
+{
+  static const node_t* find_node(const node_t& parent, const std::string_view& identifier) noexcept
+  {
+    if(parent.identifier == identifier && parent.type != Field::Undefined)
+      return &parent;
+
+    if(parent.type == Field::Array ||
+       parent.type == Field::Object)
+      for(const node_t& child : parent.toArray())
+        if(const node_t* found = find_node(child, identifier))
+          return found;
+    return nullptr;
+  }
+
+  bool FindNode(const node_t& parent, node_t& output, const std::string_view& identifier) noexcept
+  {
+    const node_t* found = find_node(parent, identifier);
+    return found != nullptr &&
+        (output = *found, true); // only the found subtree is copied
+  }
+
+  bool FindString(const node_t& parent, std::string& output, const std::string_view& identifier) noexcept
+  {
+    const node_t* child = find_node(parent, identifier);
+    return child != nullptr &&
+        child->type == Field::String &&
+        (output = child->toString(), true);
+  }
+
+  bool FindNumber(const node_t& parent, intmax_t& output, const std::string_view& identifier) noexcept
+  {
+    const node_t* child = find_node(parent, identifier);
+    return child != nullptr &&
+        child->type == Field::Integer &&
+        (output = child->toNumber(), true);
+  }
+
+  bool FindFloat(const node_t& parent, double& output, const std::string_view& identifier) noexcept
+  {
+    const node_t* child = find_node(parent, identifier);
+    return child != nullptr &&
+        child->type == Field::Float &&
+        (output = child->toFloat(), true);
+  }
+
+  bool FindBoolean(const node_t& parent, bool& output, const std::string_view& identifier) noexcept
+  {
+    const node_t* child = find_node(parent, identifier);
+    return child != nullptr &&
+        child->type == Field::Boolean &&
+        (output = child->toBool(), true);
+  }
+}
+
+SHORTJSON_INSTANTIATE(shortjson::strict_dialect);
+SHORTJSON_INSTANTIATE(shortjson::tolerant_dialect);
@@ -50,6 +50,41 @@ namespace shortjson
 #define toObject toArray // simple alias
   };
 
+  // Dialect policies select which ECMAScript extensions the parser accepts.
+  // Mix them by deriving from either dialect and overriding individual flags,
+  // then instantiate the mix with SHORTJSON_INSTANTIATE from shortjson_impl.h
+  // (and the macros of any optional module that it is used with).
+  struct strict_dialect
+  {
+    static constexpr bool apostrophe_quotes         = false; // 'string'
+    static constexpr bool hex_octal_escapes         = false; // "\x41" and "\101"
+    static constexpr bool case_insensitive_literals = false; // TRUE, False and NULL
+    static constexpr bool explicit_positive_numbers = false; // +4096
+    static constexpr bool hex_numbers               = false; // 0x1000 and 0x1p12
+    static constexpr bool octal_numbers             = false; // 010 == 8, other leading zeros are ignored (00.5)
+    static constexpr bool special_floats            = false; // Infinity, -Infinity and NaN
+    static constexpr bool digit_separators          = false; // 4_096
+  };
+
+  struct tolerant_dialect
+  {
+    static constexpr bool apostrophe_quotes         = true;
+    static constexpr bool hex_octal_escapes         = true;
+    static constexpr bool case_insensitive_literals = true;
+    static constexpr bool explicit_positive_numbers = true;
+    static constexpr bool hex_numbers               = true;
+    static constexpr bool octal_numbers             = true;
+    static constexpr bool special_floats            = true;
+    static constexpr bool digit_separators          = true;
+  };
+
+#ifdef TOLERANT_JSON
+  using default_dialect = tolerant_dialect;
+#else
+  using default_dialect = strict_dialect;
+#endif
+
+  template<typename dialect_t = default_dialect>
   node_t Parse(const std::string& json_data);
 
   bool FindNode(const node_t& parent, node_t& output, const std::string_view& identifier) noexcept;
@@ -9,14 +9,32 @@ CONFIG -= qt
 
 CONFIG += tolerant
 
-SOURCES += tests.cpp
+SOURCES += \
+  tests.cpp \
+  shortjson.cpp \
+  shortjson_patch.cpp \
+  shortjson_shared.cpp \
+  shortjson_filter.cpp \
+  shortjson_hash.cpp \
+  shortjson_schema.cpp \
+  shortjson_transcode.cpp
 
+# selects shortjson::default_dialect, both dialects are always available
 tolerant {
 DEFINES += TOLERANT_JSON
-SOURCES += shortjson_tolerant.cpp
-} else {
-SOURCES += shortjson_strict.cpp
 }
 
 HEADERS += \
-  shortjson.h
+  shortjson.h \
+  shortjson_impl.h \
+  shortjson_static.h \
+  shortjson_patch.h \
+  shortjson_shared.h \
+  shortjson_filter.h \
+  shortjson_filter_impl.h \
+  shortjson_hash.h \
+  shortjson_hash_impl.h \
+  shortjson_schema.h \
+  shortjson_schema_impl.h \
+  shortjson_transcode.h \
+  shortjson_transcode_impl.h
@@ -0,0 +1,42 @@
+#include "shortjson_filter_impl.h"
+
+namespace shortjson
+{
+  filter_t::level_t& filter_t::level(const std::vector<std::string>& path)
+  {
+    level_t* level = &m_root;
+    for(const std::string& identifier : path)
+    {
+      auto pos = std::find_if(level->members.begin(), level->members.end(),
+                              [&identifier](const level_t& member) { return member.identifier == identifier; });
+      if(pos == level->members.end())
+      {
+        pos = level->members.emplace(level->members.end());
+        pos->identifier = identifier;
+      }
+      level = &*pos;
+    }
+    return *level;
+  }
+
+  filter_t& filter_t::keep(const std::vector<std::string>& path)
+  {
+    if(path.empty())
+      throw JSON_ERROR("A projection path cannot be empty.");
+    level(path).keep = true;
+    m_projected = true;
+    return *this;
+  }
+
+  filter_t& filter_t::where(const std::vector<std::string>& path, node_t low, node_t high)
+  {
+    if(path.empty())
+      throw JSON_ERROR("A predicate path cannot be empty.");
+    level(path).predicates.push_back({ std::move(low), std::move(high) });
+    ++m_predicates;
+    return *this;
+  }
+}
+
+SHORTJSON_FILTER_INSTANTIATE(shortjson::strict_dialect);
+SHORTJSON_FILTER_INSTANTIATE(shortjson::tolerant_dialect);
@@ -0,0 +1,73 @@
+#ifndef SHORTJSON_FILTER_H
+#define SHORTJSON_FILTER_H
+
+#include "shortjson.h"
+
+#include <type_traits>
+
+namespace shortjson
+{
+  // Compiled projection and predicates for ParseFiltered().  Paths are member names relative to a record.
+  // Without any kept path the whole record is kept.  Ranges are inclusive and compare numbers or strings.
+  class filter_t
+  {
+  public:
+    struct predicate_t
+    {
+      node_t low;
+      node_t high;
+    };
+
+    struct level_t
+    {
+      std::string identifier;
+      bool keep = false; // project the entire value
+      std::vector<predicate_t> predicates;
+      std::vector<level_t> members;
+    };
+
+    filter_t& keep(const std::vector<std::string>& path);
+
+    template<typename T>
+    filter_t& equal(const std::vector<std::string>& path, const T& value)
+      { return where(path, make_value(value), make_value(value)); }
+
+    template<typename low_t, typename high_t> // bounds may differ in type, e.g. 1 and 2.5 or "a" and "bob"
+    filter_t& range(const std::vector<std::string>& path, const low_t& low, const high_t& high)
+      { return where(path, make_value(low), make_value(high)); }
+
+    inline const level_t& root(void) const noexcept { return m_root; }
+    inline size_t predicates(void) const noexcept { return m_predicates; }
+    inline bool projected(void) const noexcept { return m_projected; }
+
+  private:
+    template<typename T>
+    static node_t make_value(const T& value)
+    {
+      node_t node;
+      if constexpr(std::is_same_v<T, bool>)
+        node.type = Field::Boolean, node.data = value;
+      else if constexpr(std::is_integral_v<T>)
+        node.type = Field::Integer, node.data = intmax_t(value);
+      else if constexpr(std::is_floating_point_v<T>)
+        node.type = Field::Float, node.data = double(value);
+      else
+        node.type = Field::String, node.data = std::string(value);
+      return node;
+    }
+
+    filter_t& where(const std::vector<std::string>& path, node_t low, node_t high);
+    level_t& level(const std::vector<std::string>& path);
+
+    level_t m_root;
+    size_t m_predicates = 0;
+    bool m_projected = false;
+  };
+
+  // Parses a JSON array of records, or a sequence of top-level records (e.g. JSON Lines), keeping only the
+  // projected members of records that satisfy every predicate.  Everything else is skipped without being built.
+  template<typename dialect_t = default_dialect>
+  node_t ParseFiltered(const std::string& json_data, const filter_t& filter);
+}
+
+#endif // SHORTJSON_FILTER_H
@@ -0,0 +1,268 @@
+#ifndef SHORTJSON_FILTER_IMPL_H
+#define SHORTJSON_FILTER_IMPL_H
+
+// Definitions of ParseFiltered() for any dialect policy.  Only needed to instantiate
+// a dialect mix of your own, see SHORTJSON_FILTER_INSTANTIATE at the end of this file.
+
+#include "shortjson_filter.h"
+#include "shortjson_impl.h"
+
+namespace shortjson
+{
+  namespace detail
+  {
+    // checks the predicates of 'level' (and nested levels) against an already built value
+    inline bool evaluate(const filter_t::level_t& level, const node_t& value, size_t& satisfied) noexcept
+    {
+      for(const filter_t::predicate_t& predicate : level.predicates)
+      {
+        int low = compare(value, predicate.low);
+        int high = compare(value, predicate.high);
+        if(low == 2 || high == 2 || low < 0 || high > 0)
+          return false;
+        ++satisfied;
+      }
+
+      for(const filter_t::level_t& member : level.members)
+        if(value.type == Field::Object)
+          for(const node_t& child : value.toObject())
+            if(child.identifier == member.identifier)
+            {
+              if(!evaluate(member, child, satisfied))
+                return false;
+              break;
+            }
+      return true; // missing members are caught by the caller's predicate count
+    }
+
+    // skips over a string whose opening quote is at 'pos'
+    template <typename string_iterator>
+    inline void skip_string(string_iterator& pos, const string_iterator& end)
+    {
+      const char quote_char = *pos;
+      while((pos = std::find_if(++pos, end, [quote_char](char x) { return x == quote_char || x == '\\'; })) < end &&
+            *pos == '\\') // skip escaped character
+        ++pos;
+      if(pos >= end)
+        throw JSON_ERROR("Premature end of JSON found while processing string type.");
+      ++pos;
+    }
+
+    inline bool is_structural_char(char x) noexcept
+      { return x == '[' || x == ']' || x == '{' || x == '}' || x == '"' || x == '\''; }
+
+    // skips to the end of a container whose opening bracket has been consumed, only scanning for brackets and strings
+    template <typename dialect_t, typename string_iterator>
+    inline void skip_container_tail(string_iterator& pos, const string_iterator& end)
+    {
+      size_t depth = 1;
+      while(depth > 0)
+      {
+        pos = std::find_if(pos, end, is_structural_char);
+        if(pos >= end)
+          throw JSON_ERROR("Premature end of JSON found while skipping a value.");
+        switch(*pos)
+        {
+          case '[': case '{': ++depth; ++pos; break;
+          case ']': case '}': --depth; ++pos; break;
+          case '\'':
+            if constexpr(!dialect_t::apostrophe_quotes)
+              throw JSON_ERROR("Strings must use quotes, not apostrophes.");
+            [[fallthrough]];
+          default:
+            skip_string(pos, end);
+            break;
+        }
+      }
+    }
+
+    // skips over a value without building it
+    template <typename dialect_t, typename string_iterator>
+    inline void skip_value(string_iterator& pos, const string_iterator& end)
+    {
+      switch(*pos)
+      {
+        case '[':
+        case '{':
+          skip_container_tail<dialect_t>(++pos, end);
+          break;
+
+        case ']':
+        case '}':
+        case ',':
+        case ':':
+          throw JSON_ERROR("Expected a value.");
+
+        case '\'':
+          if constexpr(!dialect_t::apostrophe_quotes)
+            throw JSON_ERROR("Strings must use quotes, not apostrophes.");
+          [[fallthrough]];
+        case '"':
+          skip_string(pos, end);
+          break;
+
+        default:
+          pos = std::find_if(pos, end, is_primitive_end_char);
+          break;
+      }
+    }
+
+    // Filters the object at 'pos' into 'output' (which may be null when nothing below 'level' is kept).
+    // Returns false as soon as a predicate fails, after skipping the rest of the object.
+    template <typename dialect_t, typename string_iterator>
+    inline bool filter_object(const filter_t::level_t& level,
+                              bool keep_rest,
+                              node_t* output,
+                              string_iterator& pos,
+                              const string_iterator& end,
+                              size_t& satisfied)
+    {
+      ++pos; // skip '{'
+      std::string identifier;
+      node_t scratch;
+      for(;;)
+      {
+        skip_space(pos, end);
+        if(pos >= end)
+          throw JSON_ERROR("Premature end of JSON found while processing object.");
+        if(*pos == '}')
+          break;
+        if(*pos == ',')
+        {
+          ++pos;
+          continue;
+        }
+
+        if(*pos != '"' && !(dialect_t::apostrophe_quotes && *pos == '\''))
+          throw JSON_ERROR("Only a string can be a label.");
+        read_label<dialect_t>(identifier, scratch, pos, end);
+        skip_space(pos, end);
+        if(pos >= end || *pos != ':')
+          throw JSON_ERROR("Expected ':' after label.");
+        ++pos;
+        skip_space(pos, end);
+        if(pos >= end)
+          throw JSON_ERROR("Premature end of JSON found while processing object.");
+
+        auto member = std::find_if(level.members.begin(), level.members.end(),
+                                   [&identifier](const filter_t::level_t& child) { return child.identifier == identifier; });
+
+        if(member == level.members.end())
+        {
+          if(keep_rest && output != nullptr)
+          {
+            node_t& child = output->toObject().emplace_back(build_value<dialect_t>(pos, end));
+            child.identifier = identifier;
+          }
+          else
+            skip_value<dialect_t>(pos, end);
+          continue;
+        }
+
+        bool passed = true;
+        if(member->keep || (keep_rest && output != nullptr) || // entire value is kept OR
+           (!member->predicates.empty() && *pos != '{' && *pos != '[')) // value is a tested primitive
+        {
+          node_t value = build_value<dialect_t>(pos, end);
+          passed = evaluate(*member, value, satisfied);
+          if(passed && output != nullptr && (member->keep || keep_rest))
+          {
+            value.identifier = identifier;
+            output->toObject().push_back(std::move(value));
+          }
+        }
+        else if(*pos == '{' && !member->members.empty()) // descend into the nested record
+        {
+          const bool projected = output != nullptr && std::any_of(member->members.begin(), member->members.end(),
+                                                                  [](const filter_t::level_t& child) { return child.keep || !child.members.empty(); });
+          node_t child;
+          child.identifier = identifier;
+          child.type = Field::Object;
+          child.data = std::vector<node_t>();
+          passed = filter_object<dialect_t>(*member, false, projected ? &child : nullptr, pos, end, satisfied);
+          if(passed && projected && !child.toObject().empty())
+            output->toObject().push_back(std::move(child));
+        }
+        else
+          skip_value<dialect_t>(pos, end);
+
+        if(!passed)
+        {
+          skip_container_tail<dialect_t>(pos, end); // abandon the record
+          return false;
+        }
+      }
+      ++pos; // skip '}'
+      return true;
+    }
+  }
+
+  template<typename dialect_t>
+  node_t ParseFiltered(const std::string& json_data, const filter_t& filter)
+  {
+    node_t records;
+    records.type = Field::Array;
+    records.data = std::vector<node_t>();
+
+    auto pos = json_data.cbegin();
+    const auto end = json_data.cend();
+    size_t depth = 0; // records may be inside a top-level array
+
+    for(;;)
+    {
+      detail::skip_space(pos, end);
+      if(pos >= end)
+        break;
+
+      switch(*pos)
+      {
+        case '[':
+          if(depth == 0)
+          {
+            ++depth;
+            ++pos;
+            break;
+          }
+          [[fallthrough]];
+        default: // record that is not an object
+          if(filter.predicates() || filter.projected())
+            detail::skip_value<dialect_t>(pos, end);
+          else
+            records.toArray().push_back(detail::build_value<dialect_t>(pos, end));
+          break;
+
+        case ']':
+          if(depth-- != 1)
+            throw JSON_ERROR("Unexpected closing bracket.");
+          ++pos;
+          break;
+
+        case ',':
+          ++pos;
+          break;
+
+        case '{':
+        {
+          node_t record;
+          record.type = Field::Object;
+          record.data = std::vector<node_t>();
+          size_t satisfied = 0;
+          if(detail::filter_object<dialect_t>(filter.root(), !filter.projected(), &record, pos, end, satisfied) &&
+             satisfied == filter.predicates()) // every predicate found its value
+            records.toArray().push_back(std::move(record));
+          break;
+        }
+      }
+    }
+
+    if(depth != 0)
+      throw JSON_ERROR("Premature end of JSON found while processing records.");
+    return records;
+  }
+}
+
+// Instantiates ParseFiltered() for a dialect, see SHORTJSON_INSTANTIATE.
+#define SHORTJSON_FILTER_INSTANTIATE(dialect) \
+  template shortjson::node_t shortjson::ParseFiltered<dialect>(const std::string& json_data, const shortjson::filter_t& filter)
+
+#endif // SHORTJSON_FILTER_IMPL_H
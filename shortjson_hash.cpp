@@ -0,0 +1,75 @@
+#include "shortjson_hash_impl.h"
+
+namespace shortjson
+{
+  static inline bool members_equal(const std::vector<node_t>& a, const std::vector<node_t>& b)
+  {
+    if(a.size() != b.size())
+      return false;
+
+    std::vector<const node_t*> left, right;
+    left.reserve(a.size());
+    right.reserve(b.size());
+    for(const node_t& child : a)
+      left.push_back(&child);
+    for(const node_t& child : b)
+      right.push_back(&child);
+
+    const auto by_identifier = [](const node_t* x, const node_t* y) { return x->identifier < y->identifier; };
+    std::stable_sort(left.begin(), left.end(), by_identifier);
+    std::stable_sort(right.begin(), right.end(), by_identifier);
+    return std::equal(left.begin(), left.end(), right.begin(),
+                      [](const node_t* x, const node_t* y) { return x->identifier == y->identifier && *x == *y; });
+  }
+
+  bool operator==(const node_t& a, const node_t& b)
+  {
+    intmax_t integer = 0;
+    if(a.type == Field::Integer && b.type == Field::Float)
+      return detail::integral_float(b.toFloat(), integer) && integer == a.toNumber();
+    if(a.type == Field::Float && b.type == Field::Integer)
+      return detail::integral_float(a.toFloat(), integer) && integer == b.toNumber();
+    if(a.type != b.type)
+      return false;
+
+    switch(a.type)
+    {
+      case Field::Boolean: return a.toBool() == b.toBool();
+      case Field::Integer: return a.toNumber() == b.toNumber();
+      case Field::Float:   return a.toFloat() == b.toFloat();
+      case Field::String:  return a.toString() == b.toString();
+      case Field::Array:   return a.toArray() == b.toArray();
+      case Field::Object:  return members_equal(a.toObject(), b.toObject()); // member order is irrelevant
+      default: return true; // Undefined and Null have no value
+    }
+  }
+
+  void hash_builder_t::add(uint64_t element) noexcept
+    { add(std::string_view(), element); }
+
+  void hash_builder_t::add(const std::string_view& identifier, uint64_t member) noexcept
+  {
+    if(m_type == Field::Array) // order matters
+      m_state = detail::mix(m_state ^ (member + 0x9E3779B97F4A7C15ULL * ++m_count));
+    else // order is irrelevant, so members are summed
+      m_state += detail::mix(detail::hash_bytes(identifier, 0) ^ member), ++m_count;
+  }
+
+  uint64_t hash_builder_t::finish(void) const noexcept
+    { return detail::mix(m_state ^ detail::mix(uint64_t(m_type) << 56 ^ m_count)); }
+
+  uint64_t Hash(const node_t& node) noexcept
+  {
+    if(node.type != Field::Array &&
+       node.type != Field::Object)
+      return detail::hash_primitive(node);
+
+    hash_builder_t builder(node.type);
+    for(const node_t& child : node.toArray())
+      builder.add(child.identifier, Hash(child));
+    return builder.finish();
+  }
+}
+
+SHORTJSON_HASH_INSTANTIATE(shortjson::strict_dialect);
+SHORTJSON_HASH_INSTANTIATE(shortjson::tolerant_dialect);
@@ -0,0 +1,51 @@
+#ifndef SHORTJSON_HASH_H
+#define SHORTJSON_HASH_H
+
+#include "shortjson.h"
+
+#include <functional>
+
+namespace shortjson
+{
+  // Deep equality of values: object members may be in any order and numbers compare by value (1 == 1.0).
+  // The identifiers of the two nodes themselves are not compared.
+  bool operator==(const node_t& a, const node_t& b);
+  inline bool operator!=(const node_t& a, const node_t& b) { return !(a == b); }
+
+  // Canonical 64-bit hash consistent with operator==.  The hash of a container only depends on the
+  // hashes of its children (and member identifiers) so subtree hashes can be computed independently.
+  uint64_t Hash(const node_t& node) noexcept;
+
+  // Combines the hashes of a container's children, e.g. cached subtree hashes, into the Hash() of the container.
+  // Array elements must be added in order while object members may be added in any order.
+  class hash_builder_t
+  {
+  public:
+    hash_builder_t(Field container) noexcept : m_type(container), m_state(0), m_count(0) { }
+
+    void add(uint64_t element) noexcept;
+    void add(const std::string_view& identifier, uint64_t member) noexcept; // the identifier is ignored for arrays
+    uint64_t finish(void) const noexcept;
+
+  private:
+    Field    m_type;
+    uint64_t m_state;
+    uint64_t m_count;
+  };
+
+  // Same hash computed directly from JSON text without building a tree.
+  template<typename dialect_t = default_dialect>
+  uint64_t Hash(const std::string& json_data);
+}
+
+namespace std
+{
+  template<>
+  struct hash<shortjson::node_t>
+  {
+    inline size_t operator()(const shortjson::node_t& node) const noexcept
+      { return size_t(shortjson::Hash(node)); }
+  };
+}
+
+#endif // SHORTJSON_HASH_H
@@ -0,0 +1,128 @@
+#ifndef SHORTJSON_HASH_IMPL_H
+#define SHORTJSON_HASH_IMPL_H
+
+// Definitions of Hash() of JSON text for any dialect policy.  Only needed to instantiate
+// a dialect mix of your own, see SHORTJSON_HASH_INSTANTIATE at the end of this file.
+
+#include "shortjson_hash.h"
+#include "shortjson_impl.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace shortjson
+{
+  namespace detail
+  {
+    // an integral float equals the integer with the same value
+    inline bool integral_float(double value, intmax_t& integer) noexcept
+    {
+      if(!(value >= -0x1p63 && value < 0x1p63) || std::trunc(value) != value) // also rejects NaN
+        return false;
+      integer = intmax_t(value);
+      return true;
+    }
+
+    // splitmix64 finalizer
+    inline uint64_t mix(uint64_t x) noexcept
+    {
+      x ^= x >> 30;
+      x *= 0xBF58476D1CE4E5B9ULL;
+      x ^= x >> 27;
+      x *= 0x94D049BB133111EBULL;
+      return x ^ (x >> 31);
+    }
+
+    // FNV-1a
+    inline uint64_t hash_bytes(const std::string_view& data, uint64_t seed) noexcept
+    {
+      uint64_t hash = 0xCBF29CE484222325ULL ^ seed;
+      for(char x : data)
+        hash = (hash ^ uint8_t(x)) * 0x100000001B3ULL;
+      return mix(hash);
+    }
+
+    inline uint64_t hash_primitive(const node_t& node) noexcept
+    {
+      intmax_t integer = 0;
+      switch(node.type)
+      {
+        case Field::Boolean: return mix(uint64_t(Field::Boolean) << 56 | node.toBool());
+        case Field::Integer: return mix(uint64_t(Field::Integer) << 56 ^ mix(uint64_t(node.toNumber())));
+        case Field::Float:
+          if(integral_float(node.toFloat(), integer)) // hash the same as the equal integer
+            return mix(uint64_t(Field::Integer) << 56 ^ mix(uint64_t(integer)));
+          else
+          {
+            double value = node.toFloat();
+            uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return mix(uint64_t(Field::Float) << 56 ^ mix(bits));
+          }
+        case Field::String: return hash_bytes(node.toString(), uint64_t(Field::String));
+        default: return mix(uint64_t(node.type) << 56);
+      }
+    }
+
+    template <typename dialect_t, typename string_iterator>
+    inline uint64_t hash_value(string_iterator& pos, const string_iterator& end, std::string& identifier, node_t& scratch)
+    {
+      skip_space(pos, end);
+      if(pos >= end)
+        throw JSON_ERROR("Premature end of JSON found while hashing a value.");
+
+      if(*pos != '[' && *pos != '{')
+        return hash_primitive(scratch = build_value<dialect_t>(pos, end));
+
+      const bool is_object = *pos == '{';
+      const char closing = is_object ? '}' : ']';
+      hash_builder_t builder(is_object ? Field::Object : Field::Array);
+      ++pos;
+      for(;;)
+      {
+        skip_space(pos, end);
+        if(pos >= end)
+          throw JSON_ERROR("Premature end of JSON found while hashing a value.");
+        if(*pos == closing)
+          break;
+        if(*pos == ',')
+        {
+          ++pos;
+          continue;
+        }
+
+        if(is_object)
+        {
+          if(*pos != '"' && !(dialect_t::apostrophe_quotes && *pos == '\''))
+            throw JSON_ERROR("Only a string can be a label.");
+          read_label<dialect_t>(identifier, scratch, pos, end);
+          skip_space(pos, end);
+          if(pos >= end || *pos != ':')
+            throw JSON_ERROR("Expected ':' after label.");
+          ++pos;
+          std::string label = std::move(identifier);
+          builder.add(label, hash_value<dialect_t>(pos, end, identifier, scratch));
+        }
+        else
+          builder.add(std::string_view(), hash_value<dialect_t>(pos, end, identifier, scratch));
+      }
+      ++pos;
+      return builder.finish();
+    }
+  }
+
+  template<typename dialect_t>
+  uint64_t Hash(const std::string& json_data)
+  {
+    auto pos = json_data.cbegin();
+    std::string identifier;
+    node_t scratch;
+    return detail::hash_value<dialect_t>(pos, json_data.cend(), identifier, scratch);
+  }
+}
+
+// Instantiates Hash() of JSON text for a dialect, see SHORTJSON_INSTANTIATE.
+#define SHORTJSON_HASH_INSTANTIATE(dialect) \
+  template uint64_t shortjson::Hash<dialect>(const std::string& json_data)
+
+#endif // SHORTJSON_HASH_IMPL_H
@@ -0,0 +1,524 @@
+#ifndef SHORTJSON_IMPL_H
+#define SHORTJSON_IMPL_H
+
+// Definitions of the parser for any dialect policy and helpers shared with the optional modules.  Only needed
+// to instantiate a dialect mix of your own, see SHORTJSON_INSTANTIATE at the end of this file.
+
+#include "shortjson.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cinttypes>
+#include <numeric>
+#include <stack>
+
+#define Q2(x) #x
+#define Q1(x) Q2(x)
+#define JSON_ERROR(message) \
+  "file: " Q1(__FILE__) "\n" \
+  "line: " Q1(__LINE__) "\n" \
+  "JSON parser error: " message
+
+namespace shortjson
+{
+  namespace detail
+  {
+    constexpr bool is_octal_digit(const uint8_t data) noexcept
+      { return data >= '0' && data <= '7'; }
+
+    constexpr uint8_t hex_value(char x) noexcept
+      { return x <= '9' ? x - '0' : (10 + ::tolower(x) - 'a'); }
+
+    template <uint32_t base, typename string_iterator> // turns character sequence into a number
+    constexpr uint32_t reconstitute_number(string_iterator& pos,
+                                           const string_iterator& end)
+      { return std::accumulate(pos, end, 0, [](uint32_t t, char x) { return (t * base) + hex_value(x); }); }
+
+    // Convert 16 bit code point to UTF-8 string.
+    // see Table 3-6 : http://www.unicode.org/versions/Unicode6.2.0/ch03.pdf#page=42
+    inline void append_utf16(std::string& dest, uint16_t data) noexcept
+    {
+      if (data <= 0x007F) // one byte value
+        dest.push_back(char(data));
+      else if (data <= 0x07FF) // two byte value
+      {
+        dest.push_back(0xC0 + ((data & 0x07C0) >> 6));
+        dest.push_back(0x80 +  (data & 0x003F));
+      }
+      else // three byte value
+      {
+        dest.push_back(0xE0 + ((data & 0xF000) >> 12));
+        dest.push_back(0x80 + ((data & 0x0FC0) >>  6));
+        dest.push_back(0x80 +  (data & 0x003F));
+      }
+    }
+
+    template <typename dialect_t, typename string_iterator>
+    inline void parse_string(node_t& node,
+                             string_iterator& pos,
+                             const string_iterator& end)
+    {
+      const char quote_char = dialect_t::apostrophe_quotes ? *pos : '"';
+      std::string value;
+
+      while(++pos, // iterate position
+            pos < end && // NOT at End Of String AND
+           *pos != quote_char) // NOT closing quote
+      {
+        if(*pos == '\\') // escape sequence expected
+        {
+          if(++pos < end) // iterate THEN check IF at End Of String
+            switch (*pos)
+            {
+              case 'x': // hexadecimal escape symbol \x?? - value range: 0 to 255
+                if constexpr(!dialect_t::hex_octal_escapes)
+                {
+                  value.push_back('\\');
+                  value.push_back(*pos);
+                  break;
+                }
+                [[fallthrough]];
+              case 'u': // unicode escape symbol \u???? - value range: 0 to 65535
+              {
+                auto start = ++pos;
+                pos += *(pos - 1) == 'x' ? 2 : 4; // 2 for \x, 4 for \u
+                if(pos > end || !std::all_of(start, pos, ::isxdigit)) // IF exceeds End Of String OR NOT all digits are hexadecimal
+                  throw JSON_ERROR("End Of String found while decoding UTF-16 OR hexadecimal escape sequence");
+                append_utf16(value, reconstitute_number<16>(start, pos--));
+                break;
+              }
+
+              // octal sequence
+              case '0': case '1': case '2': case '3':
+              case '4': case '5': case '6': case '7':
+                if constexpr(dialect_t::hex_octal_escapes)
+                { // value range: 0 to 511
+                  auto oct_end = std::find_if_not(pos, pos + 3 < end ? pos + 3 : end, is_octal_digit);  // find last octal digit (max of 3 digits)
+                  append_utf16(value, reconstitute_number<8>(pos, oct_end));
+                  pos = oct_end - 1;
+                }
+                else
+                {
+                  value.push_back('\\');
+                  value.push_back(*pos);
+                }
+                break;
+
+              case '"':
+              case '\'':
+                if(quote_char != *pos)
+                  value.push_back('\\');
+                value.push_back(*pos);
+                break; // quote
+
+              // normally escaped symbols
+              case '/': value.push_back('/'); break; // slash (escaping mandatory?)
+              case '\\':value.push_back('\\'); break; // backslash
+              case 'b': value.push_back('\b'); break; // backspace
+              case 'f': value.push_back('\f'); break; // feed
+              case 'r': value.push_back('\r'); break; // return (to line start)
+              case 'n': value.push_back('\n'); break; // newline
+              case 't': value.push_back('\t'); break; // tab
+              case 'v': value.push_back('\v'); break; // vertical tab
+              case 'a': value.push_back('\a'); break; // audible bell
+
+              default: // some other escape character or unexpected symbol
+                value.push_back('\\');
+                value.push_back(*pos);
+                break;
+            }
+        }
+        else
+          value.push_back(*pos);
+      }
+
+      if(pos >= end)
+        throw JSON_ERROR("Premature end of JSON found while processing string type.");
+
+      node.type = Field::String;
+      node.data = value;
+    }
+
+    // same as std::isspace() and std::iscntrl() in the "C" locale without the function call
+    constexpr bool is_space(char x) noexcept
+      { return x == ' ' || (x >= '\t' && x <= '\r'); }
+
+    constexpr bool is_control(char x) noexcept
+      { return uint8_t(x) < 0x20 || x == 0x7F; }
+
+    inline bool is_primitive_end_char(char x)
+    {
+      return is_control(x) ||
+          x == ' ' || // only non-control character whitespace
+          x == ':' ||
+          x == ',' ||
+          x == ']' ||
+          x == '}';
+    }
+
+    // accepts -?(0|[1-9][0-9]*) as an integer and -?((0|[1-9][0-9]*)[.][0-9]*|[.]?[0-9]+)([eE][+-]?[0-9]+)? as a float
+    // or, when 'leading_zeros' is set, any number of digits in place of (0|[1-9][0-9]*)
+    inline Field decimal_type(const std::string& value, bool leading_zeros) noexcept
+    {
+      auto pos = value.begin() + (!value.empty() && value.front() == '-');
+      const auto digits_start = pos;
+      pos = std::find_if_not(pos, value.end(), ::isdigit);
+      const bool integer_part = pos != digits_start;
+      bool fraction_part = false;
+
+      if(!leading_zeros && integer_part && *digits_start == '0' && pos - digits_start > 1) // leading zero
+        return Field::Undefined;
+
+      if(pos == value.end())
+        return integer_part ? Field::Integer : Field::Undefined;
+
+      if(*pos == '.')
+      {
+        auto fraction_start = ++pos;
+        pos = std::find_if_not(pos, value.end(), ::isdigit);
+        fraction_part = pos != fraction_start;
+      }
+
+      if(!integer_part && !fraction_part)
+        return Field::Undefined;
+
+      if(pos != value.end() && (*pos == 'e' || *pos == 'E'))
+      {
+        if(++pos != value.end() && (*pos == '+' || *pos == '-'))
+          ++pos;
+        auto exponent_start = pos;
+        pos = std::find_if_not(pos, value.end(), ::isdigit);
+        if(pos == exponent_start)
+          return Field::Undefined;
+      }
+
+      return pos == value.end() ? Field::Float : Field::Undefined;
+    }
+
+    // accepts [0-9a-fA-F]+ as an integer and ([0-9a-fA-F]+[.]?[0-9a-fA-F]*|[.][0-9a-fA-F]+)([pP][+-]?[0-9]+)? as a float
+    // after the "0x" prefix, which std::stod() converts
+    inline Field hexadecimal_type(const std::string& value, size_t digits_offset) noexcept
+    {
+      auto pos = value.begin() + digits_offset;
+      const auto digits_start = pos;
+      pos = std::find_if_not(pos, value.end(), ::isxdigit);
+      bool digits = pos != digits_start;
+      bool is_float = false;
+
+      if(pos != value.end() && *pos == '.')
+      {
+        auto fraction_start = ++pos;
+        pos = std::find_if_not(pos, value.end(), ::isxdigit);
+        digits |= pos != fraction_start;
+        is_float = true;
+      }
+
+      if(!digits)
+        return Field::Undefined;
+
+      if(pos != value.end() && (*pos == 'p' || *pos == 'P'))
+      {
+        if(++pos != value.end() && (*pos == '+' || *pos == '-'))
+          ++pos;
+        auto exponent_start = pos;
+        pos = std::find_if_not(pos, value.end(), ::isdigit);
+        if(pos == exponent_start)
+          return Field::Undefined;
+        is_float = true;
+      }
+
+      if(pos != value.end())
+        return Field::Undefined;
+      return is_float ? Field::Float : Field::Integer;
+    }
+
+    // "inf", "infinity" and "nan" in any case with an optional sign, as accepted by std::stod()
+    inline bool is_special_float(const std::string& value) noexcept
+    {
+      std::string name = value.substr(!value.empty() && (value.front() == '-' || value.front() == '+'));
+      std::transform(name.begin(), name.end(), name.begin(), ::tolower);
+      return name == "inf" || name == "infinity" || name == "nan";
+    }
+
+    inline intmax_t to_integer(const std::string& value, int base)
+    {
+      errno = 0;
+      const intmax_t number = std::strtoimax(value.c_str(), nullptr, base); // skips the sign and "0x"
+      if(errno == ERANGE)
+        throw JSON_ERROR("Integer out of range.");
+      return number;
+    }
+
+    // Removes digit separators and an explicit '+' sign, then returns the type of the remaining number
+    // without converting it.  'base' is set to the radix of integers and to 16 for hexadecimal floats.
+    template <typename dialect_t>
+    inline Field prepare_number(std::string& value, int& base)
+    {
+      if constexpr(dialect_t::digit_separators)
+      {
+        size_t offset = 0;
+        while((offset = value.find('_', offset)) != std::string::npos) // while "search for a '_' seperator" succeeds
+          value.erase(offset, 1); // erase the seperator from the copied primitive
+      }
+
+      if(!value.empty() && value.front() == '+')
+      {
+        if constexpr(!dialect_t::explicit_positive_numbers)
+          throw JSON_ERROR("Numbers cannot be explicitly positive.");
+        value.erase(0, 1);
+        if(!value.empty() && (value.front() == '+' || value.front() == '-')) // only one sign
+          throw JSON_ERROR("Unrecognized primitive type. Possibly an unquoted string.");
+      }
+
+      base = 10;
+      if constexpr(dialect_t::special_floats)
+        if(is_special_float(value))
+          return Field::Float;
+
+      const size_t sign = !value.empty() && value.front() == '-';
+      if(value.size() > sign + 1 && value[sign] == '0' && (value[sign + 1] == 'x' || value[sign + 1] == 'X'))
+      {
+        if constexpr(!dialect_t::hex_numbers)
+          throw JSON_ERROR("Hexadecimal numbers are invalid.");
+        const Field type = hexadecimal_type(value, sign + 2);
+        if(type == Field::Undefined)
+          throw JSON_ERROR("Unrecognized primitive type. Possibly an unquoted string.");
+        base = 16;
+        return type;
+      }
+
+      Field type = decimal_type(value, dialect_t::octal_numbers);
+      if(type == Field::Undefined) // Unexpected character for an integer or float primitive.  Maybe it's neither of those.
+        throw JSON_ERROR("Unrecognized primitive type. Possibly an unquoted string.");
+
+      if constexpr(dialect_t::octal_numbers)
+        if(type == Field::Integer && value.size() > sign + 1 && value[sign] == '0') // leading zero
+        {
+          if(std::all_of(value.begin() + sign, value.end(), is_octal_digit))
+            base = 8;
+          else // e.g. 08 is the float 8.0 like std::stod() reads it
+            type = Field::Float;
+        }
+      return type;
+    }
+
+    template <typename dialect_t>
+    inline void parse_number(node_t& node,
+                             std::string& value)
+    {
+      int base = 10;
+      node.type = prepare_number<dialect_t>(value, base);
+      if(node.type == Field::Float)
+        node.data = std::stod(value); // convert, including hexadecimal floats, infinity and NaN
+      else
+        node.data = to_integer(value, base); // convert
+    }
+
+    template <typename dialect_t, typename string_iterator>
+    inline void parse_primitive(node_t& node,
+                                string_iterator& pos,
+                                const string_iterator& end)
+    {
+      string_iterator start = pos;
+
+      pos = std::find_if(pos, end, is_primitive_end_char); // finds the character that terminates the primitive
+
+      if(pos >= end) // parsing error occured
+        throw JSON_ERROR("Premature end of JSON found while processing primitive.");
+
+      if(!is_space(*pos) && is_control(*pos))
+        throw JSON_ERROR("Non-space control character found in primitive. Possibly an unquoted string.");
+
+      std::string value(start, pos); // copy the primitive
+      if constexpr(dialect_t::case_insensitive_literals)
+        std::transform(value.begin(), value.end(), value.begin(), ::tolower); // transform the copy to lowercase
+
+      if(value == "true") // if boolean true
+      {
+        node.type = Field::Boolean;
+        node.data = true;
+      }
+      else if(value == "false") // if boolean false
+      {
+        node.type = Field::Boolean;
+        node.data = false;
+      }
+      else if(value == "null") // if value is null
+        node.type = Field::Null;
+      else if(std::isalpha(uint8_t(value.front())) && !(dialect_t::special_floats && is_special_float(value)))
+        throw JSON_ERROR("Unrecognized primitive type.\n"
+                         "  * Strings must use quotes.\n"
+                         "  * Boolean and null values must be lowercase.");
+      else // numeric value is the only type left
+        parse_number<dialect_t>(node, value);
+    }
+
+    // parse_value() hooks that do nothing, see schema_validator
+    struct no_validator
+    {
+      inline void open(const node_t&) noexcept { }
+      inline void close(const node_t&) noexcept { }
+      inline void label(const std::string&) noexcept { }
+      inline void value(const node_t&) noexcept { }
+      inline void next(void) noexcept { }
+    };
+
+    // parses until End Of String OR, when 'single_value' is set, until the first value is complete
+    template <typename dialect_t, typename validator_t = no_validator, typename string_iterator>
+    inline node_t parse_value(string_iterator& pos,
+                              const string_iterator& end,
+                              bool single_value,
+                              validator_t validator = validator_t())
+    {
+      node_t root;
+      root.data = std::vector<node_t> { node_t() };
+
+      std::vector<node_t>::iterator iter = root.toArray().begin(); // create new node and get iterator
+      std::stack<std::vector<node_t>::iterator> lineage;
+      lineage.push(iter); // this stack MUST NEVER be empty
+
+      while(pos < end && // NOT at End Of String AND
+            !(single_value && lineage.size() == 1 && iter->type != Field::Undefined)) // NOT done with a single value
+      {
+        if(!is_space(*pos)) // ignore spaces
+          switch(*pos)
+          {
+            case '[': // beginning of new node
+            case '{':
+            {
+              lineage.push(iter); // remember the current position so that we can return
+              iter->type = *pos == '[' ? Field::Array : Field::Object;
+              iter->data = std::vector<node_t>();
+              validator.open(*iter);
+              iter = iter->toArray().emplace(iter->toArray().cend()); // create new node and get iterator
+              break;
+            }
+
+            case '}': // end of current node
+            case ']':
+              if(iter->type == Field::Undefined) // if node is unfilled (can happen with a trailing comma)
+                lineage.top()->toArray().erase(iter); // delete the unfilled node
+              validator.close(*lineage.top());
+              lineage.pop();
+              iter = lineage.top();
+              break;
+
+            case '\'':
+              if constexpr(!dialect_t::apostrophe_quotes)
+                throw JSON_ERROR("Strings must use quotes, not apostrophes.");
+              [[fallthrough]];
+            case '"': // open quote
+              parse_string<dialect_t>(*iter, pos, end);
+              validator.value(*iter); // may still turn out to be a label
+              break;
+
+            case ':': // indicates current value is a name
+              if(iter->type != Field::String)
+                throw JSON_ERROR("Only a string can be a label.");
+              iter->type = Field::Undefined;
+              iter->identifier = iter->toString();
+              validator.label(iter->identifier);
+              break;
+
+            case ',':
+              if(iter->type != Field::Array &&
+                 iter->type != Field::Object)
+                iter = lineage.top();
+              iter = iter->toArray().emplace(iter->toArray().cend()); // create new node and get iterator
+              validator.next();
+              break;
+
+            default:
+              parse_primitive<dialect_t>(*iter, pos, end);
+              validator.value(*iter);
+              continue; // immediate jump to start of loop (avoid iterating)
+          }
+        ++pos;
+      }
+      return std::move(root.toArray().front()); // root Object always contains a single node.  explicitly move node_t
+    }
+
+    // The helpers below are shared by the optional modules that read values without building a tree.
+
+    // returns <0, 0 or >0 like strcmp() OR 2 when the values cannot be compared
+    inline int compare(const node_t& a, const node_t& b) noexcept
+    {
+      if(a.type == Field::Integer && b.type == Field::Integer)
+        return a.toNumber() < b.toNumber() ? -1 : a.toNumber() > b.toNumber();
+      if((a.type == Field::Integer || a.type == Field::Float) &&
+         (b.type == Field::Integer || b.type == Field::Float))
+      {
+        double x = a.type == Field::Integer ? double(a.toNumber()) : a.toFloat();
+        double y = b.type == Field::Integer ? double(b.toNumber()) : b.toFloat();
+        return x < y ? -1 : x > y ? 1 : x == y ? 0 : 2; // NaN is not comparable
+      }
+      if(a.type == Field::String && b.type == Field::String)
+      {
+        int result = a.toString().compare(b.toString());
+        return result < 0 ? -1 : result > 0;
+      }
+      if(a.type == Field::Boolean && b.type == Field::Boolean)
+        return int(a.toBool()) - int(b.toBool());
+      return 2;
+    }
+
+    template <typename string_iterator>
+    inline void skip_space(string_iterator& pos, const string_iterator& end) noexcept
+      { pos = std::find_if_not(pos, end, is_space); }
+
+    // builds a single value, avoiding the container machinery for strings and primitives
+    template <typename dialect_t, typename string_iterator>
+    inline node_t build_value(string_iterator& pos, const string_iterator& end)
+    {
+      node_t value;
+      if(*pos == '[' || *pos == '{')
+        value = parse_value<dialect_t>(pos, end, true);
+      else if(*pos == '"' || (dialect_t::apostrophe_quotes && *pos == '\''))
+      {
+        parse_string<dialect_t>(value, pos, end);
+        ++pos; // skip closing quote
+      }
+      else if(*pos == '\'')
+        throw JSON_ERROR("Strings must use quotes, not apostrophes.");
+      else
+        parse_primitive<dialect_t>(value, pos, end);
+      return value;
+    }
+
+    // reads a label, only decoding escape sequences when there are any
+    template <typename dialect_t, typename string_iterator>
+    inline void read_label(std::string& label, node_t& scratch, string_iterator& pos, const string_iterator& end)
+    {
+      const char quote_char = *pos;
+      auto label_end = std::find_if(pos + 1, end, [quote_char](char x) { return x == quote_char || x == '\\'; });
+      if(label_end < end && *label_end == quote_char)
+      {
+        label.assign(pos + 1, label_end);
+        pos = label_end + 1;
+      }
+      else
+      {
+        parse_string<dialect_t>(scratch, pos, end);
+        label = scratch.toString();
+        ++pos; // skip closing quote
+      }
+    }
+  }
+
+  template<typename dialect_t>
+  node_t Parse(const std::string& json_data)
+  {
+    auto pos = json_data.cbegin();
+    return detail::parse_value<dialect_t>(pos, json_data.cend(), false);
+  }
+}
+
+// Instantiates Parse() for a dialect.  Put it in exactly one source file that includes this header, e.g. for
+// a mix derived from strict_dialect:
+//   struct separated_dialect : shortjson::strict_dialect { static constexpr bool digit_separators = true; };
+//   SHORTJSON_INSTANTIATE(separated_dialect);
+// The optional modules have their own macros, e.g. SHORTJSON_TRANSCODE_INSTANTIATE in shortjson_transcode_impl.h.
+#define SHORTJSON_INSTANTIATE(dialect) \
+  template shortjson::node_t shortjson::Parse<dialect>(const std::string& json_data)
+
+#endif // SHORTJSON_IMPL_H
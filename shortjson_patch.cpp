@@ -0,0 +1,322 @@
+#include "shortjson_patch.h"
+#include "shortjson_hash.h" // operator== for the test operation
+
+#include <algorithm>
+#include <cstdlib>
+
+#define Q2(x) #x
+#define Q1(x) Q2(x)
+#define JSON_ERROR(message) \
+  "file: " Q1(__FILE__) "\n" \
+  "line: " Q1(__LINE__) "\n" \
+  "JSON patch error: " message
+
+namespace shortjson
+{
+  static inline bool is_container(const node_t& node) noexcept
+    { return node.type == Field::Array || node.type == Field::Object; }
+
+  static const node_t* find_member(const node_t& object, const std::string_view& identifier) noexcept
+  {
+    if(object.type != Field::Object)
+      return nullptr;
+    auto pos = std::find_if(object.toObject().begin(), object.toObject().end(),
+                            [&identifier](const node_t& child) { return child.identifier == identifier; });
+    return pos == object.toObject().end() ? nullptr : &*pos;
+  }
+
+  // splits a JSON Pointer (RFC 6901) into its unescaped reference tokens
+  static std::vector<std::string> split_pointer(const std::string_view& pointer)
+  {
+    std::vector<std::string> tokens;
+    if(pointer.empty()) // whole document
+      return tokens;
+    if(pointer.front() != '/')
+      throw JSON_ERROR("JSON Pointer must begin with '/'.");
+
+    for(auto pos = pointer.begin(); pos != pointer.end(); )
+    {
+      auto token_end = std::find(++pos, pointer.end(), '/');
+      std::string& token = tokens.emplace_back();
+      for(; pos != token_end; ++pos)
+      {
+        if(*pos != '~')
+          token.push_back(*pos);
+        else if(++pos != token_end && (*pos == '0' || *pos == '1'))
+          token.push_back(*pos == '0' ? '~' : '/');
+        else
+          throw JSON_ERROR("Invalid '~' escape in JSON Pointer.");
+      }
+    }
+    return tokens;
+  }
+
+  static std::string escape_token(const std::string_view& token)
+  {
+    std::string escaped;
+    for(char x : token)
+      switch(x)
+      {
+        case '~': escaped.append("~0"); break;
+        case '/': escaped.append("~1"); break;
+        default: escaped.push_back(x); break;
+      }
+    return escaped;
+  }
+
+  // array indices are unsigned base 10 numbers without leading zeros, "-" refers to the end of the array
+  static size_t array_index(const node_t& array, const std::string& token, bool allow_end)
+  {
+    if(allow_end && token == "-")
+      return array.toArray().size();
+
+    if(token.empty() ||
+       !std::all_of(token.begin(), token.end(), ::isdigit) ||
+       (token.size() > 1 && token.front() == '0'))
+      throw JSON_ERROR("Invalid array index in JSON Pointer.");
+
+    size_t index = std::strtoull(token.c_str(), nullptr, 10);
+    if(index > array.toArray().size() || (!allow_end && index == array.toArray().size()))
+      throw JSON_ERROR("Array index out of bounds.");
+    return index;
+  }
+
+  static std::vector<node_t>::iterator find_child(node_t& parent, const std::string& token)
+  {
+    if(parent.type == Field::Array)
+      return parent.toArray().begin() + array_index(parent, token, false);
+
+    if(parent.type == Field::Object)
+    {
+      auto pos = std::find_if(parent.toObject().begin(), parent.toObject().end(),
+                              [&token](const node_t& child) { return child.identifier == token; });
+      if(pos != parent.toObject().end())
+        return pos;
+    }
+    throw JSON_ERROR("JSON Pointer references a nonexistent value.");
+  }
+
+  // follows all but the last 'tokens'
+  static node_t& resolve_parent(node_t& document, const std::vector<std::string>& tokens)
+  {
+    node_t* node = &document;
+    for(auto token = tokens.begin(); token + 1 < tokens.end(); ++token)
+      node = &*find_child(*node, *token);
+    return *node;
+  }
+
+  static node_t& get_value(node_t& document, const std::string_view& path)
+  {
+    std::vector<std::string> tokens = split_pointer(path);
+    if(tokens.empty())
+      return document;
+    return *find_child(resolve_parent(document, tokens), tokens.back());
+  }
+
+  static void add_value(node_t& document, const std::string_view& path, node_t value)
+  {
+    std::vector<std::string> tokens = split_pointer(path);
+    if(tokens.empty()) // replace whole document
+    {
+      value.identifier = document.identifier;
+      document = std::move(value);
+      return;
+    }
+
+    node_t& parent = resolve_parent(document, tokens);
+    if(parent.type == Field::Array)
+    {
+      value.identifier.clear();
+      parent.toArray().emplace(parent.toArray().begin() + array_index(parent, tokens.back(), true), std::move(value));
+    }
+    else if(parent.type == Field::Object)
+    {
+      value.identifier = tokens.back();
+      auto pos = std::find_if(parent.toObject().begin(), parent.toObject().end(),
+                              [&value](const node_t& child) { return child.identifier == value.identifier; });
+      if(pos == parent.toObject().end())
+        parent.toObject().emplace_back(std::move(value));
+      else
+        *pos = std::move(value);
+    }
+    else
+      throw JSON_ERROR("Only an array or object can have a value added.");
+  }
+
+  static node_t remove_value(node_t& document, const std::string_view& path)
+  {
+    std::vector<std::string> tokens = split_pointer(path);
+    if(tokens.empty())
+      throw JSON_ERROR("The whole document cannot be removed.");
+
+    node_t& parent = resolve_parent(document, tokens);
+    auto pos = find_child(parent, tokens.back());
+    node_t value = std::move(*pos);
+    parent.toArray().erase(pos);
+    return value;
+  }
+
+  static const std::string& string_member(const node_t& operation, const std::string_view& identifier)
+  {
+    const node_t* member = find_member(operation, identifier);
+    if(member == nullptr || member->type != Field::String)
+      throw JSON_ERROR("Patch operation is missing a string member.");
+    return member->toString();
+  }
+
+  static const node_t& value_member(const node_t& operation)
+  {
+    const node_t* member = find_member(operation, "value");
+    if(member == nullptr)
+      throw JSON_ERROR("Patch operation is missing its \"value\" member.");
+    return *member;
+  }
+
+  void ApplyPatch(node_t& document, const node_t& patch)
+  {
+    if(patch.type != Field::Array)
+      throw JSON_ERROR("JSON Patch must be an array of operations.");
+
+    for(const node_t& operation : patch.toArray())
+    {
+      const std::string& op = string_member(operation, "op");
+      const std::string& path = string_member(operation, "path");
+
+      if(op == "add")
+        add_value(document, path, value_member(operation));
+      else if(op == "remove")
+        remove_value(document, path);
+      else if(op == "replace")
+      {
+        node_t& target = get_value(document, path);
+        std::string identifier = std::move(target.identifier);
+        target = value_member(operation);
+        target.identifier = std::move(identifier);
+      }
+      else if(op == "move")
+      {
+        const std::string& from = string_member(operation, "from");
+        if(path.size() > from.size() && path.compare(0, from.size(), from) == 0 && path[from.size()] == '/')
+          throw JSON_ERROR("A value cannot be moved into one of its children.");
+        add_value(document, path, remove_value(document, from));
+      }
+      else if(op == "copy")
+        add_value(document, path, get_value(document, string_member(operation, "from")));
+      else if(op == "test")
+      {
+        if(get_value(document, path) != value_member(operation))
+          throw JSON_ERROR("Test operation failed.");
+      }
+      else
+        throw JSON_ERROR("Unrecognized patch operation.");
+    }
+  }
+
+  void ApplyMergePatch(node_t& document, const node_t& patch)
+  {
+    if(patch.type != Field::Object) // anything other than an object replaces the target
+    {
+      std::string identifier = std::move(document.identifier);
+      document = patch;
+      document.identifier = std::move(identifier);
+      return;
+    }
+
+    if(document.type != Field::Object)
+    {
+      document.type = Field::Object;
+      document.data = std::vector<node_t>();
+    }
+
+    std::vector<node_t>& members = document.toObject();
+    for(const node_t& change : patch.toObject())
+    {
+      auto pos = std::find_if(members.begin(), members.end(),
+                              [&change](const node_t& child) { return child.identifier == change.identifier; });
+      if(change.type == Field::Null) // null removes the member
+      {
+        if(pos != members.end())
+          members.erase(pos);
+      }
+      else
+      {
+        if(pos == members.end())
+        {
+          pos = members.emplace(members.end());
+          pos->identifier = change.identifier;
+        }
+        ApplyMergePatch(*pos, change);
+      }
+    }
+  }
+
+  static node_t make_string(const std::string& identifier, std::string value)
+  {
+    node_t node;
+    node.identifier = identifier;
+    node.type = Field::String;
+    node.data = std::move(value);
+    return node;
+  }
+
+  static void add_operation(node_t& patch, const char* op, const std::string& path, const node_t* value)
+  {
+    node_t& operation = patch.toArray().emplace_back();
+    operation.type = Field::Object;
+    operation.data = std::vector<node_t>();
+    operation.toObject().push_back(make_string("op", op));
+    operation.toObject().push_back(make_string("path", path));
+    if(value != nullptr)
+    {
+      operation.toObject().push_back(*value);
+      operation.toObject().back().identifier = "value";
+    }
+  }
+
+  static void diff_node(node_t& patch, const std::string& path, const node_t& source, const node_t& target)
+  {
+    if(source.type != target.type || !is_container(source))
+    {
+      if(source != target)
+        add_operation(patch, "replace", path, &target);
+      return;
+    }
+
+    if(source.type == Field::Object)
+    {
+      for(const node_t& child : source.toObject())
+      {
+        const node_t* other = find_member(target, child.identifier);
+        if(other == nullptr)
+          add_operation(patch, "remove", path + '/' + escape_token(child.identifier), nullptr);
+        else
+          diff_node(patch, path + '/' + escape_token(child.identifier), child, *other);
+      }
+      for(const node_t& child : target.toObject())
+        if(find_member(source, child.identifier) == nullptr)
+          add_operation(patch, "add", path + '/' + escape_token(child.identifier), &child);
+    }
+    else // arrays are compared element by element
+    {
+      const std::vector<node_t>& before = source.toArray();
+      const std::vector<node_t>& after = target.toArray();
+      const size_t common = std::min(before.size(), after.size());
+
+      for(size_t index = 0; index < common; ++index)
+        diff_node(patch, path + '/' + std::to_string(index), before[index], after[index]);
+      for(size_t index = before.size(); index > common; --index) // remove from the back so indices stay valid
+        add_operation(patch, "remove", path + '/' + std::to_string(index - 1), nullptr);
+      for(size_t index = common; index < after.size(); ++index)
+        add_operation(patch, "add", path + '/' + std::to_string(index), &after[index]);
+    }
+  }
+
+  node_t Diff(const node_t& source, const node_t& target)
+  {
+    node_t patch;
+    patch.type = Field::Array;
+    patch.data = std::vector<node_t>();
+    diff_node(patch, std::string(), source, target);
+    return patch;
+  }
+}
@@ -0,0 +1,20 @@
+#ifndef SHORTJSON_PATCH_H
+#define SHORTJSON_PATCH_H
+
+#include "shortjson.h"
+
+namespace shortjson
+{
+  // RFC 6902 JSON Patch: 'patch' is an array of operation objects, applied to 'document' in place.
+  // Throws a const char* error message when an operation fails, in which case 'document' holds
+  // the result of the operations that preceded it.
+  void ApplyPatch(node_t& document, const node_t& patch);
+
+  // RFC 7386 JSON Merge Patch: 'patch' is merged into 'document' in place.
+  void ApplyMergePatch(node_t& document, const node_t& patch);
+
+  // Creates an RFC 6902 JSON Patch that turns 'source' into 'target'.
+  node_t Diff(const node_t& source, const node_t& target);
+}
+
+#endif // SHORTJSON_PATCH_H
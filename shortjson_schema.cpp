@@ -0,0 +1,87 @@
+#include "shortjson_schema_impl.h"
+
+namespace shortjson
+{
+  static uint16_t schema_type(const std::string& name)
+  {
+    if(name == "null")    return detail::type_bit(Field::Null);
+    if(name == "boolean") return detail::type_bit(Field::Boolean);
+    if(name == "object")  return detail::type_bit(Field::Object);
+    if(name == "array")   return detail::type_bit(Field::Array);
+    if(name == "string")  return detail::type_bit(Field::String);
+    if(name == "integer") return detail::type_bit(Field::Integer);
+    if(name == "number")  return detail::type_bit(Field::Integer) | detail::type_bit(Field::Float);
+    throw JSON_ERROR("Unrecognized schema type.");
+  }
+
+  static size_t schema_size(const node_t& keyword)
+  {
+    if(keyword.type == Field::Integer && keyword.toNumber() >= 0)
+      return size_t(keyword.toNumber());
+    throw JSON_ERROR("Schema length and item limits must be non-negative integers.");
+  }
+
+  static const node_t& schema_bound(const node_t& keyword)
+  {
+    if(keyword.type == Field::Integer || keyword.type == Field::Float)
+      return keyword;
+    throw JSON_ERROR("Schema numeric bounds must be numbers.");
+  }
+
+  schema_t::schema_t(const node_t& schema)
+    { compile(schema); }
+
+  size_t schema_t::compile(const node_t& schema)
+  {
+    const size_t index = m_rules.size();
+    m_rules.emplace_back();
+    if(schema.type != Field::Object) // e.g. the "true" schema
+      return index;
+
+    for(const node_t& keyword : schema.toObject())
+    {
+      const std::string& name = keyword.identifier;
+      if(name == "type")
+      {
+        if(keyword.type == Field::String)
+          m_rules[index].types = schema_type(keyword.toString());
+        else if(keyword.type == Field::Array)
+          for(const node_t& type : keyword.toArray())
+            m_rules[index].types |= schema_type(type.type == Field::String ? type.toString() : std::string());
+      }
+      else if(name == "enum" && keyword.type == Field::Array)
+        m_rules[index].enumeration = keyword.toArray();
+      else if(name == "minimum")          m_rules[index].minimum = schema_bound(keyword);
+      else if(name == "maximum")          m_rules[index].maximum = schema_bound(keyword);
+      else if(name == "exclusiveMinimum") m_rules[index].exclusive_minimum = schema_bound(keyword);
+      else if(name == "exclusiveMaximum") m_rules[index].exclusive_maximum = schema_bound(keyword);
+      else if(name == "minLength") m_rules[index].min_length = schema_size(keyword);
+      else if(name == "maxLength") m_rules[index].max_length = schema_size(keyword);
+      else if(name == "minItems")  m_rules[index].min_items = schema_size(keyword);
+      else if(name == "maxItems")  m_rules[index].max_items = schema_size(keyword);
+      else if(name == "items" && keyword.type == Field::Object)
+      {
+        size_t items = compile(keyword); // may reallocate m_rules
+        m_rules[index].items = items;
+      }
+      else if(name == "properties" && keyword.type == Field::Object)
+        for(const node_t& property : keyword.toObject())
+        {
+          size_t rule = compile(property);
+          m_rules[index].properties.emplace_back(property.identifier, rule);
+        }
+      else if(name == "required" && keyword.type == Field::Array)
+      {
+        for(const node_t& required : keyword.toArray())
+          if(required.type == Field::String)
+            m_rules[index].required.push_back(required.toString());
+      }
+      else if(name == "additionalProperties" && keyword.type == Field::Boolean)
+        m_rules[index].additional_properties = keyword.toBool();
+    }
+    return index;
+  }
+}
+
+SHORTJSON_SCHEMA_INSTANTIATE(shortjson::strict_dialect);
+SHORTJSON_SCHEMA_INSTANTIATE(shortjson::tolerant_dialect);
@@ -0,0 +1,49 @@
+#ifndef SHORTJSON_SCHEMA_H
+#define SHORTJSON_SCHEMA_H
+
+#include "shortjson.h"
+
+namespace shortjson
+{
+  // JSON Schema subset compiled into rules that are checked while parsing: type, enum, minimum, maximum,
+  // exclusiveMinimum, exclusiveMaximum, minLength, maxLength, minItems, maxItems, items, properties,
+  // additionalProperties (boolean) and required.  Other keywords are ignored.
+  class schema_t
+  {
+  public:
+    static constexpr size_t none = size_t(-1);
+
+    struct rule_t
+    {
+      uint16_t types = 0; // one bit per Field, zero allows any type
+      std::vector<node_t> enumeration;
+      node_t minimum; // numeric bounds are Field::Undefined when absent
+      node_t maximum;
+      node_t exclusive_minimum;
+      node_t exclusive_maximum;
+      size_t min_length = 0;
+      size_t max_length = none;
+      size_t min_items = 0;
+      size_t max_items = none;
+      size_t items = none; // rule index
+      std::vector<std::pair<std::string, size_t>> properties; // member identifier and rule index
+      std::vector<std::string> required;
+      bool additional_properties = true;
+    };
+
+    explicit schema_t(const node_t& schema);
+
+    inline const rule_t& rule(size_t index) const noexcept { return m_rules[index]; }
+
+  private:
+    size_t compile(const node_t& schema);
+
+    std::vector<rule_t> m_rules; // root rule is first
+  };
+
+  // Parses and validates in a single pass, throwing at the first schema violation.
+  template<typename dialect_t = default_dialect>
+  node_t Parse(const std::string& json_data, const schema_t& schema);
+}
+
+#endif // SHORTJSON_SCHEMA_H
@@ -0,0 +1,185 @@
+#ifndef SHORTJSON_SCHEMA_IMPL_H
+#define SHORTJSON_SCHEMA_IMPL_H
+
+// Definitions of the validating Parse() for any dialect policy.  Only needed to instantiate
+// a dialect mix of your own, see SHORTJSON_SCHEMA_INSTANTIATE at the end of this file.
+
+#include "shortjson_schema.h"
+#include "shortjson_hash_impl.h"
+
+namespace shortjson
+{
+  namespace detail
+  {
+    constexpr uint16_t type_bit(Field type) noexcept
+      { return uint16_t(1 << uint8_t(type)); }
+
+    // parse_value() hooks that check each value against the compiled schema as soon as it is complete
+    class schema_validator
+    {
+    public:
+      schema_validator(const schema_t& schema) noexcept : m_schema(schema) { }
+
+      void open(const node_t& node)
+      {
+        const size_t rule = begin_value();
+        if(rule != schema_t::none)
+          check_type(m_schema.rule(rule), node);
+
+        frame_t& frame = m_frames.emplace_back();
+        frame.rule = rule;
+        frame.is_array = node.type == Field::Array;
+        frame.child = frame.is_array && rule != schema_t::none ? m_schema.rule(rule).items : schema_t::none;
+        if(rule != schema_t::none)
+          frame.required.resize(m_schema.rule(rule).required.size());
+      }
+
+      void close(const node_t& node)
+      {
+        if(m_frames.empty())
+          return;
+
+        const frame_t& frame = m_frames.back();
+        if(frame.rule != schema_t::none)
+        {
+          const schema_t::rule_t& rule = m_schema.rule(frame.rule);
+          if(frame.is_array && node.toArray().size() < rule.min_items)
+            throw JSON_ERROR("Schema violation: too few array items.");
+          if(std::find(frame.required.begin(), frame.required.end(), false) != frame.required.end())
+            throw JSON_ERROR("Schema violation: required member missing.");
+          check_enumeration(rule, node);
+        }
+        m_frames.pop_back();
+      }
+
+      void label(const std::string& identifier)
+      {
+        if(m_frames.empty() || m_frames.back().is_array)
+          return;
+
+        frame_t& frame = m_frames.back();
+        frame.expecting_value = true;
+        frame.child = schema_t::none;
+        if(frame.rule == schema_t::none)
+          return;
+
+        const schema_t::rule_t& rule = m_schema.rule(frame.rule);
+        auto property = std::find_if(rule.properties.begin(), rule.properties.end(),
+                                     [&identifier](const std::pair<std::string, size_t>& entry) { return entry.first == identifier; });
+        if(property != rule.properties.end())
+          frame.child = property->second;
+        else if(!rule.additional_properties)
+          throw JSON_ERROR("Schema violation: member not allowed.");
+
+        auto required = std::find(rule.required.begin(), rule.required.end(), identifier);
+        if(required != rule.required.end())
+          frame.required[size_t(required - rule.required.begin())] = true;
+      }
+
+      void value(const node_t& node)
+      {
+        if(!m_frames.empty() && !m_frames.back().is_array && !m_frames.back().expecting_value) // a label, not a value
+          return;
+
+        const size_t rule = begin_value();
+        if(rule == schema_t::none)
+          return;
+
+        const schema_t::rule_t& checks = m_schema.rule(rule);
+        check_type(checks, node);
+        check_enumeration(checks, node);
+
+        if(node.type == Field::Integer || node.type == Field::Float)
+        {
+          if(beyond(node, checks.minimum, -1, false) || beyond(node, checks.exclusive_minimum, -1, true))
+            throw JSON_ERROR("Schema violation: value below minimum.");
+          if(beyond(node, checks.maximum, 1, false) || beyond(node, checks.exclusive_maximum, 1, true))
+            throw JSON_ERROR("Schema violation: value above maximum.");
+        }
+        else if(node.type == Field::String)
+        {
+          const size_t length = size_t(std::count_if(node.toString().begin(), node.toString().end(),
+                                                     [](char x) { return (uint8_t(x) & 0xC0) != 0x80; })); // code points, not bytes
+          if(length < checks.min_length)
+            throw JSON_ERROR("Schema violation: string too short.");
+          if(length > checks.max_length)
+            throw JSON_ERROR("Schema violation: string too long.");
+        }
+      }
+
+      void next(void) noexcept
+      {
+        if(!m_frames.empty() && !m_frames.back().is_array)
+        {
+          m_frames.back().expecting_value = false;
+          m_frames.back().child = schema_t::none;
+        }
+      }
+
+    private:
+      struct frame_t
+      {
+        size_t rule;
+        size_t child; // rule for the next value
+        size_t count = 0;
+        bool is_array;
+        bool expecting_value = false;
+        std::vector<bool> required;
+      };
+
+      // counts array items (failing as soon as there are too many) and returns the rule for the new value
+      size_t begin_value(void)
+      {
+        if(m_frames.empty())
+          return 0;
+
+        frame_t& frame = m_frames.back();
+        if(frame.is_array && frame.rule != schema_t::none &&
+           ++frame.count > m_schema.rule(frame.rule).max_items)
+          throw JSON_ERROR("Schema violation: too many array items.");
+        return frame.child;
+      }
+
+      // true when 'node' is on the 'side' (-1 below, 1 above) of 'bound' or, for an exclusive bound, equal to it
+      static bool beyond(const node_t& node, const node_t& bound, int side, bool exclusive) noexcept
+      {
+        if(bound.type == Field::Undefined) // no bound
+          return false;
+        const int result = compare(node, bound);
+        return result == 2 || result == side || (exclusive && result == 0);
+      }
+
+      static void check_type(const schema_t::rule_t& rule, const node_t& node)
+      {
+        intmax_t integer = 0;
+        if(rule.types != 0 &&
+           !(rule.types & type_bit(node.type)) &&
+           !(node.type == Field::Float && (rule.types & type_bit(Field::Integer)) && integral_float(node.toFloat(), integer)))
+          throw JSON_ERROR("Schema violation: unexpected type.");
+      }
+
+      static void check_enumeration(const schema_t::rule_t& rule, const node_t& node)
+      {
+        if(!rule.enumeration.empty() &&
+           std::find(rule.enumeration.begin(), rule.enumeration.end(), node) == rule.enumeration.end())
+          throw JSON_ERROR("Schema violation: value not in enumeration.");
+      }
+
+      const schema_t& m_schema;
+      std::vector<frame_t> m_frames;
+    };
+  }
+
+  template<typename dialect_t>
+  node_t Parse(const std::string& json_data, const schema_t& schema)
+  {
+    auto pos = json_data.cbegin();
+    return detail::parse_value<dialect_t>(pos, json_data.cend(), false, detail::schema_validator(schema));
+  }
+}
+
+// Instantiates the validating Parse() for a dialect, see SHORTJSON_INSTANTIATE.
+#define SHORTJSON_SCHEMA_INSTANTIATE(dialect) \
+  template shortjson::node_t shortjson::Parse<dialect>(const std::string& json_data, const shortjson::schema_t& schema)
+
+#endif // SHORTJSON_SCHEMA_IMPL_H
@@ -0,0 +1,270 @@
+#include "shortjson_shared.h"
+#include "shortjson_hash.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#define Q2(x) #x
+#define Q1(x) Q2(x)
+#define JSON_ERROR(message) \
+  "file: " Q1(__FILE__) "\n" \
+  "line: " Q1(__LINE__) "\n" \
+  "JSON document error: " message
+
+namespace shortjson
+{
+  shared_node_t::shared_node_t(node_t node)
+  {
+    value_t data = false;
+
+    switch(node.type)
+    {
+      case Field::Array:
+      case Field::Object:
+      {
+        children_t children;
+        children.reserve(node.toArray().size());
+        for(node_t& child : node.toArray())
+          children.emplace_back(std::move(child));
+        data = std::move(children);
+        break;
+      }
+      default:
+        std::visit([&data](auto& value)
+                   {
+                     if constexpr(!std::is_same_v<std::decay_t<decltype(value)>, std::vector<node_t>>)
+                       data = std::move(value);
+                   }, node.data);
+        break;
+    }
+
+    m_data = std::make_shared<const data_t>(std::move(node.identifier), node.type, std::move(data));
+  }
+
+  const std::string& shared_node_t::identifier(void) const noexcept
+  {
+    static const std::string empty;
+    return m_data ? m_data->identifier : empty;
+  }
+
+  Field shared_node_t::type(void) const noexcept
+    { return m_data ? m_data->type : Field::Undefined; }
+
+  node_t shared_node_t::toNode(void) const
+  {
+    node_t node;
+    if(!m_data)
+      return node;
+
+    node.identifier = m_data->identifier;
+    node.type = m_data->type;
+    if(std::holds_alternative<children_t>(m_data->data))
+    {
+      std::vector<node_t> children;
+      children.reserve(toArray().size());
+      for(const shared_node_t& child : toArray())
+        children.emplace_back(child.toNode());
+      node.data = std::move(children);
+    }
+    else
+      std::visit([&node](const auto& value)
+                 {
+                   if constexpr(!std::is_same_v<std::decay_t<decltype(value)>, children_t>)
+                     node.data = value;
+                 }, m_data->data);
+    return node;
+  }
+
+  shared_node_t shared_node_t::renamed(const std::string_view& identifier) const
+  {
+    if(!m_data)
+      throw JSON_ERROR("An undefined node cannot be added.");
+    if(m_data->identifier == identifier)
+      return *this;
+    return shared_node_t(std::make_shared<const data_t>(std::string(identifier), m_data->type, m_data->data, // children are shared, not copied
+                                                        m_data->hash.load(std::memory_order_relaxed))); // the identifier is not part of the hash
+  }
+
+  shared_node_t shared_node_t::with_children(children_t children) const
+    { return shared_node_t(std::make_shared<const data_t>(m_data->identifier, m_data->type, std::move(children))); }
+
+  uint64_t Hash(const shared_node_t& node)
+  {
+    if(!node.m_data)
+      return Hash(node_t());
+
+    uint64_t hash = node.m_data->hash.load(std::memory_order_relaxed);
+    if(hash != 0)
+      return hash;
+
+    if(node.type() == Field::Array ||
+       node.type() == Field::Object)
+    {
+      hash_builder_t builder(node.type());
+      for(const shared_node_t& child : node.toArray())
+        builder.add(child.identifier(), Hash(child));
+      hash = builder.finish();
+    }
+    else
+      hash = Hash(node.toNode());
+
+    node.m_data->hash.store(hash, std::memory_order_relaxed); // every thread computes the same value
+    return hash;
+  }
+
+  static const shared_node_t* find_member(const shared_node_t& object, const std::string_view& identifier) noexcept
+  {
+    auto pos = std::find_if(object.toObject().begin(), object.toObject().end(),
+                            [&identifier](const shared_node_t& child) { return child.identifier() == identifier; });
+    return pos == object.toObject().end() ? nullptr : &*pos;
+  }
+
+  shared_node_t shared_node_t::with(const std::string_view& identifier, const shared_node_t& value) const
+  {
+    if(type() != Field::Object)
+      throw JSON_ERROR("Only an object has members.");
+
+    children_t children = toObject(); // copies references only
+    auto pos = std::find_if(children.begin(), children.end(),
+                            [&identifier](const shared_node_t& child) { return child.identifier() == identifier; });
+    if(pos == children.end())
+      children.push_back(value.renamed(identifier));
+    else
+      *pos = value.renamed(identifier);
+    return with_children(std::move(children));
+  }
+
+  shared_node_t shared_node_t::with(size_t index, const shared_node_t& value) const
+  {
+    if(type() != Field::Array)
+      throw JSON_ERROR("Only an array has elements.");
+    if(index >= toArray().size())
+      throw JSON_ERROR("Array index out of bounds.");
+
+    children_t children = toArray();
+    children[index] = value.renamed(std::string_view());
+    return with_children(std::move(children));
+  }
+
+  shared_node_t shared_node_t::without(const std::string_view& identifier) const
+  {
+    if(type() != Field::Object)
+      throw JSON_ERROR("Only an object has members.");
+
+    children_t children = toObject();
+    children.erase(std::remove_if(children.begin(), children.end(),
+                                  [&identifier](const shared_node_t& child) { return child.identifier() == identifier; }),
+                   children.end());
+    return with_children(std::move(children));
+  }
+
+  shared_node_t shared_node_t::without(size_t index) const
+  {
+    if(type() != Field::Array)
+      throw JSON_ERROR("Only an array has elements.");
+    if(index >= toArray().size())
+      throw JSON_ERROR("Array index out of bounds.");
+
+    children_t children = toArray();
+    children.erase(children.begin() + index);
+    return with_children(std::move(children));
+  }
+
+  // array indices are unsigned base 10 numbers
+  static size_t array_index(const shared_node_t& array, const std::string& element)
+  {
+    if(element.empty() || !std::all_of(element.begin(), element.end(), ::isdigit))
+      throw JSON_ERROR("Invalid array index in path.");
+    size_t index = std::strtoull(element.c_str(), nullptr, 10);
+    if(index >= array.toArray().size())
+      throw JSON_ERROR("Array index out of bounds.");
+    return index;
+  }
+
+  shared_node_t shared_node_t::updated(std::vector<std::string>::const_iterator pos,
+                                       const std::vector<std::string>::const_iterator& end,
+                                       const shared_node_t* value) const
+  {
+    if(pos == end) // replace this node
+    {
+      if(value == nullptr)
+        throw JSON_ERROR("The whole document cannot be removed.");
+      return value->renamed(identifier());
+    }
+
+    const std::string& element = *pos++;
+    if(type() == Field::Array)
+    {
+      const size_t index = array_index(*this, element);
+      if(pos == end && value == nullptr)
+        return without(index);
+      return with(index, toArray()[index].updated(pos, end, value));
+    }
+
+    if(pos == end) // the last element may name a new member
+      return value == nullptr ? without(element) : with(element, *value);
+
+    const shared_node_t* child = type() == Field::Object ? find_member(*this, element) : nullptr;
+    if(child == nullptr)
+      throw JSON_ERROR("Path references a nonexistent value.");
+    return with(element, child->updated(pos, end, value));
+  }
+
+  shared_node_t shared_node_t::with(const std::vector<std::string>& path, const shared_node_t& value) const
+    { return updated(path.begin(), path.end(), &value); }
+
+  shared_node_t shared_node_t::without(const std::vector<std::string>& path) const
+    { return updated(path.begin(), path.end(), nullptr); }
+
+  static const shared_node_t* find_node(const shared_node_t& parent, const std::string_view& identifier) noexcept
+  {
+    if(parent.identifier() == identifier && parent.type() != Field::Undefined)
+      return &parent;
+
+    if(parent.type() == Field::Array ||
+       parent.type() == Field::Object)
+      for(const shared_node_t& child : parent.toArray())
+        if(const shared_node_t* found = find_node(child, identifier))
+          return found;
+    return nullptr;
+  }
+
+  bool FindNode(const shared_node_t& parent, shared_node_t& output, const std::string_view& identifier) noexcept
+  {
+    const shared_node_t* found = find_node(parent, identifier);
+    return found != nullptr &&
+        (output = *found, true); // O(1) copy
+  }
+
+  bool FindString(const shared_node_t& parent, std::string& output, const std::string_view& identifier) noexcept
+  {
+    const shared_node_t* child = find_node(parent, identifier);
+    return child != nullptr &&
+        child->type() == Field::String &&
+        (output = child->toString(), true);
+  }
+
+  bool FindNumber(const shared_node_t& parent, intmax_t& output, const std::string_view& identifier) noexcept
+  {
+    const shared_node_t* child = find_node(parent, identifier);
+    return child != nullptr &&
+        child->type() == Field::Integer &&
+        (output = child->toNumber(), true);
+  }
+
+  bool FindFloat(const shared_node_t& parent, double& output, const std::string_view& identifier) noexcept
+  {
+    const shared_node_t* child = find_node(parent, identifier);
+    return child != nullptr &&
+        child->type() == Field::Float &&
+        (output = child->toFloat(), true);
+  }
+
+  bool FindBoolean(const shared_node_t& parent, bool& output, const std::string_view& identifier) noexcept
+  {
+    const shared_node_t* child = find_node(parent, identifier);
+    return child != nullptr &&
+        child->type() == Field::Boolean &&
+        (output = child->toBool(), true);
+  }
+}
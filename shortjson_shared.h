@@ -0,0 +1,92 @@
+#ifndef SHORTJSON_SHARED_H
+#define SHORTJSON_SHARED_H
+
+#include "shortjson.h"
+
+#include <atomic>
+#include <memory>
+
+namespace shortjson
+{
+  // Immutable node that shares its subtrees through reference counting.
+  // Copies are O(1) and may be read from any number of threads without locking.
+  // Modifications produce a new node that shares every unchanged subtree with the original.
+  class shared_node_t
+  {
+  public:
+    using children_t = std::vector<shared_node_t>;
+    using value_t = std::variant<bool, intmax_t, double, std::string, children_t>;
+
+    shared_node_t(void) noexcept = default;
+    explicit shared_node_t(node_t node);
+
+    const std::string& identifier(void) const noexcept;
+    Field type(void) const noexcept;
+
+    // an undefined node has the default value of every type
+    inline const bool&        toBool  (void) const noexcept { return m_data ? std::get<bool       >(m_data->data) : undefined<bool       >(); }
+    inline const intmax_t&    toNumber(void) const noexcept { return m_data ? std::get<intmax_t   >(m_data->data) : undefined<intmax_t   >(); }
+    inline const double&      toFloat (void) const noexcept { return m_data ? std::get<double     >(m_data->data) : undefined<double     >(); }
+    inline const std::string& toString(void) const noexcept { return m_data ? std::get<std::string>(m_data->data) : undefined<std::string>(); }
+    inline const children_t&  toArray (void) const noexcept { return m_data ? std::get<children_t >(m_data->data) : undefined<children_t >(); }
+
+    // true when both nodes refer to the same immutable data
+    inline bool shares(const shared_node_t& other) const noexcept { return m_data == other.m_data; }
+
+    friend uint64_t Hash(const shared_node_t& node);
+
+    node_t toNode(void) const; // deep copy into a mutable tree
+
+    // Object member / array element replacement.  Unknown object members are appended.
+    shared_node_t with(const std::string_view& identifier, const shared_node_t& value) const;
+    shared_node_t with(size_t index, const shared_node_t& value) const;
+
+    shared_node_t without(const std::string_view& identifier) const;
+    shared_node_t without(size_t index) const;
+
+    // Nested replacement/removal.  Each path element is a member name or, inside an array, a decimal index.
+    // Only the nodes along the path are copied, every other subtree is shared.
+    shared_node_t with(const std::vector<std::string>& path, const shared_node_t& value) const;
+    shared_node_t without(const std::vector<std::string>& path) const;
+
+  private:
+    struct data_t
+    {
+      data_t(std::string name, Field field, value_t value, uint64_t cached_hash = 0)
+        : identifier(std::move(name)), type(field), data(std::move(value)), hash(cached_hash) { }
+
+      std::string identifier;
+      Field       type;
+      value_t     data;
+      mutable std::atomic<uint64_t> hash; // zero until computed
+    };
+
+    template<typename T>
+    static const T& undefined(void) noexcept
+    {
+      static const T value {};
+      return value;
+    }
+
+    shared_node_t(std::shared_ptr<const data_t> data) noexcept : m_data(std::move(data)) { }
+    shared_node_t renamed(const std::string_view& identifier) const;
+    shared_node_t with_children(children_t children) const;
+    shared_node_t updated(std::vector<std::string>::const_iterator pos,
+                          const std::vector<std::string>::const_iterator& end,
+                          const shared_node_t* value) const;
+
+    std::shared_ptr<const data_t> m_data;
+  };
+
+  // Same as Hash() of toNode() but computed once per subtree, so a modified copy only hashes the changed path.
+  uint64_t Hash(const shared_node_t& node);
+
+  bool FindNode(const shared_node_t& parent, shared_node_t& output, const std::string_view& identifier) noexcept;
+
+  bool FindString(const shared_node_t& parent, std::string& output, const std::string_view& identifier) noexcept;
+  bool FindNumber(const shared_node_t& parent, intmax_t& output, const std::string_view& identifier) noexcept;
+  bool FindFloat(const shared_node_t& parent, double& output, const std::string_view& identifier) noexcept;
+  bool FindBoolean(const shared_node_t& parent, bool& output, const std::string_view& identifier) noexcept;
+}
+
+#endif // SHORTJSON_SHARED_H
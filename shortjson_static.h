@@ -0,0 +1,658 @@
+#ifndef SHORTJSON_STATIC_H
+#define SHORTJSON_STATIC_H
+
+#include "shortjson.h"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+
+// Parses a JSON literal at compile time.  Malformed JSON fails the build.
+//   constexpr auto defaults = SHORTJSON_STATIC_PARSE(R"({ "port" : 8080 })");
+#define SHORTJSON_STATIC_PARSE(json_literal) \
+  shortjson::StaticParse<shortjson::StaticNodeCount(json_literal), std::string_view(json_literal).size()>(json_literal)
+
+namespace shortjson
+{
+  // Nodes are stored flat in pre-order: the first child of a node immediately follows it
+  // and each child's 'end' is the index of its next sibling.
+  struct static_node_t
+  {
+    std::size_t identifier_offset = 0;
+    std::size_t identifier_length = 0;
+    std::size_t string_offset = 0;
+    std::size_t string_length = 0;
+    std::size_t end = 0; // index one past the last node of this subtree
+    Field       type = Field::Undefined;
+    bool        boolean = false;
+    intmax_t    integer = 0;
+    double      real = 0.0;
+
+    constexpr const bool&     toBool  (void) const noexcept { return boolean; }
+    constexpr const intmax_t& toNumber(void) const noexcept { return integer; }
+    constexpr const double&   toFloat (void) const noexcept { return real; }
+  };
+
+  template<std::size_t node_count, std::size_t string_capacity>
+  struct static_document_t
+  {
+    std::array<static_node_t, node_count> nodes {};
+    std::array<char, string_capacity> strings {}; // decoded strings and identifiers
+
+    constexpr const static_node_t& root(void) const noexcept { return nodes[0]; }
+
+    constexpr std::string_view identifier(const static_node_t& node) const noexcept
+      { return std::string_view(strings.data() + node.identifier_offset, node.identifier_length); }
+
+    constexpr std::string_view toString(const static_node_t& node) const noexcept
+      { return std::string_view(strings.data() + node.string_offset, node.string_length); }
+  };
+
+  namespace detail
+  {
+    // Unsigned integer that is just large enough for exact float conversion (see decimal_to_double).
+    class big_integer_t
+    {
+    public:
+      constexpr big_integer_t(uint64_t value) noexcept
+        : m_limbs(), m_size(0)
+      {
+        for(; value != 0; value >>= 32)
+          m_limbs[m_size++] = uint32_t(value);
+      }
+
+      constexpr void multiply(uint32_t factor)
+      {
+        uint64_t carry = 0;
+        for(std::size_t i = 0; i < m_size; ++i)
+        {
+          carry += uint64_t(m_limbs[i]) * factor;
+          m_limbs[i] = uint32_t(carry);
+          carry >>= 32;
+        }
+        if(carry != 0)
+          push(uint32_t(carry));
+      }
+
+      constexpr void add(uint32_t value)
+      {
+        uint64_t carry = value;
+        for(std::size_t i = 0; carry != 0 && i < m_size; ++i)
+        {
+          carry += m_limbs[i];
+          m_limbs[i] = uint32_t(carry);
+          carry >>= 32;
+        }
+        if(carry != 0)
+          push(uint32_t(carry));
+      }
+
+      constexpr void multiply_pow10(int exponent)
+      {
+        for(; exponent >= 9; exponent -= 9)
+          multiply(1000000000);
+        uint32_t factor = 1;
+        for(; exponent > 0; --exponent)
+          factor *= 10;
+        multiply(factor);
+      }
+
+      constexpr void multiply_pow2(int exponent)
+      {
+        if(m_size == 0)
+          return;
+        const std::size_t limbs = std::size_t(exponent / 32);
+        const int bits = exponent % 32;
+        if(bits != 0)
+          multiply(uint32_t(1) << bits);
+        if(m_size + limbs > capacity)
+          throw "JSON parser error: Float has too many digits.";
+        for(std::size_t i = m_size; i > 0; --i)
+          m_limbs[i - 1 + limbs] = m_limbs[i - 1];
+        for(std::size_t i = 0; i < limbs; ++i)
+          m_limbs[i] = 0;
+        m_size += limbs;
+      }
+
+      // returns <0, 0 or >0 like strcmp()
+      constexpr int compare(const big_integer_t& other) const noexcept
+      {
+        if(m_size != other.m_size)
+          return m_size < other.m_size ? -1 : 1;
+        for(std::size_t i = m_size; i > 0; --i)
+          if(m_limbs[i - 1] != other.m_limbs[i - 1])
+            return m_limbs[i - 1] < other.m_limbs[i - 1] ? -1 : 1;
+        return 0;
+      }
+
+    private:
+      static constexpr std::size_t capacity = 128; // 4096 bits covers 769 digits at the extremes of the double range
+
+      constexpr void push(uint32_t limb)
+      {
+        if(m_size >= capacity)
+          throw "JSON parser error: Float has too many digits.";
+        m_limbs[m_size++] = limb;
+      }
+
+      std::array<uint32_t, capacity> m_limbs;
+      std::size_t m_size;
+    };
+
+    constexpr double power_of_ten(int exponent) noexcept // exact for exponents up to 22
+    {
+      double value = 1.0;
+      for(; exponent > 0; --exponent)
+        value *= 10.0;
+      return value;
+    }
+
+    // compares digits * 10^exponent with halfway * 2^binary_exponent exactly
+    constexpr int compare_halfway(const big_integer_t& digits, int exponent, uint64_t halfway, int binary_exponent)
+    {
+      big_integer_t left = digits;
+      big_integer_t right(halfway);
+      if(exponent > 0)
+        left.multiply_pow10(exponent);
+      else
+        right.multiply_pow10(-exponent);
+      if(binary_exponent > 0)
+        right.multiply_pow2(binary_exponent);
+      else
+        left.multiply_pow2(-binary_exponent);
+      return left.compare(right);
+    }
+
+    // Converts the unsigned decimal "integer.fraction" * 10^exponent to the nearest double (ties to even) like std::stod().
+    // Short values with small exponents are exact in double arithmetic.  Otherwise an estimate is corrected with exact
+    // comparisons against the halfway points between neighbouring doubles.
+    constexpr double decimal_to_double(std::string_view integer, std::string_view fraction, int exponent)
+    {
+      constexpr uint64_t hidden_bit = uint64_t(1) << 52;
+      constexpr int min_exponent = -1074; // of the least significant bit of a subnormal
+      constexpr int max_exponent = 971; // of the least significant bit of the largest double
+      constexpr int max_digits = 769; // more digits than any halfway point between doubles needs
+
+      const int length = int(integer.size() + fraction.size());
+      auto digit = [&integer, &fraction](int n) -> uint32_t
+        { return uint32_t((std::size_t(n) < integer.size() ? integer[std::size_t(n)] : fraction[std::size_t(n) - integer.size()]) - '0'); };
+
+      int first = 0;
+      int last = length - 1;
+      while(first < length && digit(first) == 0) // skip leading zeros
+        ++first;
+      if(first == length)
+        return 0.0;
+      while(digit(last) == 0) // skip trailing zeros
+        --last;
+
+      exponent += int(integer.size()) - 1 - last; // 'exponent' now applies to the last significant digit
+      const int scale = exponent + last - first + 1; // value is in [10^(scale - 1), 10^scale)
+      if(scale > 310)
+        throw "JSON parser error: Float out of range.";
+      if(scale < -330)
+        return 0.0; // below half of the smallest subnormal
+
+      bool truncated = false;
+      if(last - first + 1 > max_digits) // the cut off digits are not all zero, a trailing 1 keeps the value between the same doubles
+      {
+        exponent += last - (first + max_digits - 1) - 1;
+        last = first + max_digits - 1;
+        truncated = true;
+      }
+
+      uint64_t mantissa = 0;
+      int estimate_exponent = exponent + truncated; // the estimate ignores the trailing 1
+      for(int n = first; n <= last; ++n)
+      {
+        if(n - first < 19)
+          mantissa = mantissa * 10 + digit(n);
+        else
+          ++estimate_exponent;
+      }
+
+      if(!truncated && last - first < 19 && mantissa <= (hidden_bit << 1) && // exact mantissa AND
+         estimate_exponent >= -22 && estimate_exponent <= 22) // exact power of ten
+        return estimate_exponent < 0 ?
+            double(mantissa) / power_of_ten(-estimate_exponent) :
+            double(mantissa) * power_of_ten(estimate_exponent);
+
+      double estimate = double(mantissa);
+      for(; estimate_exponent > 22; estimate_exponent -= 22)
+        estimate *= power_of_ten(22);
+      for(; estimate_exponent < -22; estimate_exponent += 22)
+        estimate /= power_of_ten(22);
+      estimate = estimate_exponent < 0 ? estimate / power_of_ten(-estimate_exponent) : estimate * power_of_ten(estimate_exponent);
+
+      // decompose the estimate into m * 2^k with m normalized unless subnormal
+      uint64_t m = 0;
+      int k = min_exponent;
+      if(!(estimate <= std::numeric_limits<double>::max())) // overflowed estimate
+        m = (hidden_bit << 1) - 1, k = max_exponent;
+      else if(estimate > 0.0)
+      {
+        for(k = 0; estimate >= double(hidden_bit << 1); ++k)
+          estimate *= 0.5;
+        for(; estimate < double(hidden_bit) && k > min_exponent; --k)
+          estimate *= 2.0;
+        m = uint64_t(estimate);
+      }
+
+      big_integer_t digits(0);
+      for(int n = first; n <= last; ++n)
+      {
+        digits.multiply(10);
+        digits.add(digit(n));
+      }
+      if(truncated)
+      {
+        digits.multiply(10);
+        digits.add(1);
+      }
+
+      for(;;)
+      {
+        const int above = compare_halfway(digits, exponent, 2 * m + 1, k - 1);
+        if(above > 0 || (above == 0 && (m & 1)))
+        {
+          if(++m == hidden_bit << 1)
+            m = hidden_bit, ++k;
+          if(k > max_exponent)
+            throw "JSON parser error: Float out of range.";
+          continue;
+        }
+
+        if(m == 0)
+          break;
+        const bool boundary = m == hidden_bit && k > min_exponent; // the next lower double is half as far away
+        const int below = boundary ?
+            compare_halfway(digits, exponent, (hidden_bit << 2) - 1, k - 2) :
+            compare_halfway(digits, exponent, 2 * m - 1, k - 1);
+        if(below < 0 || (below == 0 && (m & 1)))
+        {
+          if(boundary)
+            m = (hidden_bit << 1) - 1, --k;
+          else
+            --m;
+          continue;
+        }
+        break;
+      }
+
+      double value = double(m);
+      for(; k > 0; --k)
+        value *= 2.0;
+      for(; k < 0; ++k)
+        value *= 0.5;
+      return value;
+    }
+
+    // A node_count of zero only counts the nodes so that the document can be sized.
+    template<std::size_t node_count, std::size_t string_capacity>
+    class static_parser
+    {
+    public:
+      constexpr static_parser(std::string_view json) noexcept
+        : m_json(json), m_pos(0), m_count(0), m_length(0), m_scratch() { }
+
+      static_document_t<node_count, string_capacity> document;
+
+      constexpr std::size_t parse(void)
+      {
+        skip_whitespace();
+        parse_value(0, 0);
+        skip_whitespace();
+        if(m_pos != m_json.size())
+          throw "JSON parser error: Unexpected data after the root value.";
+        return m_count;
+      }
+
+    private:
+      static constexpr bool is_space(char x) noexcept
+        { return x == ' ' || x == '\t' || x == '\n' || x == '\r' || x == '\v' || x == '\f'; }
+
+      static constexpr bool is_digit(char x) noexcept
+        { return x >= '0' && x <= '9'; }
+
+      static constexpr int hex_value(char x) noexcept
+      {
+        return is_digit(x) ? x - '0' :
+               x >= 'a' && x <= 'f' ? 10 + x - 'a' :
+               x >= 'A' && x <= 'F' ? 10 + x - 'A' : -1;
+      }
+
+      static constexpr bool is_primitive_end_char(char x) noexcept
+      {
+        return static_cast<unsigned char>(x) < 0x20 || x == 0x7F ||
+            x == ' ' ||
+            x == ':' ||
+            x == ',' ||
+            x == ']' ||
+            x == '}';
+      }
+
+      constexpr static_node_t& node(std::size_t index)
+      {
+        if constexpr(node_count == 0)
+          return m_scratch;
+        else
+        {
+          if(index >= node_count)
+            throw "JSON parser error: Node count mismatch.";
+          return document.nodes[index];
+        }
+      }
+
+      constexpr void push_char(char x)
+      {
+        if constexpr(string_capacity != 0)
+        {
+          if(m_length >= string_capacity)
+            throw "JSON parser error: String storage exhausted.";
+          document.strings[m_length] = x;
+        }
+        ++m_length;
+      }
+
+      constexpr char peek(void) const
+      {
+        if(m_pos >= m_json.size())
+          throw "JSON parser error: Premature end of JSON.";
+        return m_json[m_pos];
+      }
+
+      constexpr void skip_whitespace(void) noexcept
+      {
+        while(m_pos < m_json.size() && is_space(m_json[m_pos]))
+          ++m_pos;
+      }
+
+      // Convert 16 bit code point to UTF-8 string.
+      constexpr void append_utf16(uint16_t data)
+      {
+        if (data <= 0x007F) // one byte value
+          push_char(char(data));
+        else if (data <= 0x07FF) // two byte value
+        {
+          push_char(char(0xC0 + ((data & 0x07C0) >> 6)));
+          push_char(char(0x80 +  (data & 0x003F)));
+        }
+        else // three byte value
+        {
+          push_char(char(0xE0 + ((data & 0xF000) >> 12)));
+          push_char(char(0x80 + ((data & 0x0FC0) >>  6)));
+          push_char(char(0x80 +  (data & 0x003F)));
+        }
+      }
+
+      // escape handling mirrors the runtime parser's strict dialect
+      constexpr void parse_string(void)
+      {
+        while(++m_pos, peek() != '"')
+        {
+          if(m_json[m_pos] != '\\')
+            push_char(m_json[m_pos]);
+          else
+            switch(++m_pos, peek())
+            {
+              case 'u': // unicode escape symbol \u???? - value range: 0 to 65535
+              {
+                uint16_t value = 0;
+                for(int i = 0; i < 4; ++i)
+                {
+                  ++m_pos;
+                  if(hex_value(peek()) < 0)
+                    throw "JSON parser error: Invalid UTF-16 escape sequence.";
+                  value = uint16_t((value << 4) | hex_value(m_json[m_pos]));
+                }
+                append_utf16(value);
+                break;
+              }
+
+              // normally escaped symbols
+              case '"': push_char('"'); break;
+              case '/': push_char('/'); break;
+              case '\\':push_char('\\'); break;
+              case 'b': push_char('\b'); break;
+              case 'f': push_char('\f'); break;
+              case 'r': push_char('\r'); break;
+              case 'n': push_char('\n'); break;
+              case 't': push_char('\t'); break;
+              case 'v': push_char('\v'); break;
+              case 'a': push_char('\a'); break;
+
+              default: // some other escape character or unexpected symbol
+                push_char('\\');
+                push_char(m_json[m_pos]);
+                break;
+            }
+        }
+        ++m_pos; // skip closing quote
+      }
+
+      constexpr void parse_number(static_node_t& output, std::string_view token)
+      {
+        std::size_t i = 0;
+        const bool negative = i < token.size() && token[i] == '-';
+        if(negative)
+          ++i;
+
+        const std::size_t integer_start = i;
+        while(i < token.size() && is_digit(token[i]))
+          ++i;
+        const std::string_view integer = token.substr(integer_start, i - integer_start);
+        if(integer.size() > 1 && integer.front() == '0')
+          throw "JSON parser error: Numbers cannot have leading zeros.";
+
+        std::string_view fraction;
+        bool is_float = false;
+        if(i < token.size() && token[i] == '.')
+        {
+          is_float = true;
+          const std::size_t fraction_start = ++i;
+          while(i < token.size() && is_digit(token[i]))
+            ++i;
+          fraction = token.substr(fraction_start, i - fraction_start);
+        }
+
+        if(integer.empty() && fraction.empty())
+          throw "JSON parser error: Unrecognized primitive type.";
+
+        int exponent = 0;
+        if(i < token.size() && (token[i] == 'e' || token[i] == 'E'))
+        {
+          is_float = true;
+          bool negative_exponent = false;
+          if(++i < token.size() && (token[i] == '+' || token[i] == '-'))
+            negative_exponent = token[i++] == '-';
+          std::size_t digits = 0;
+          for(; i < token.size() && is_digit(token[i]); ++i, ++digits)
+            if(exponent < 100000)
+              exponent = exponent * 10 + (token[i] - '0');
+          if(!digits)
+            throw "JSON parser error: Malformed exponent.";
+          if(negative_exponent)
+            exponent = -exponent;
+        }
+
+        if(i != token.size())
+          throw "JSON parser error: Unrecognized primitive type.";
+
+        if(!is_float)
+        {
+          const uint64_t limit = uint64_t(std::numeric_limits<intmax_t>::max()) + (negative ? 1 : 0);
+          uint64_t value = 0;
+          for(char x : integer)
+          {
+            if(value > (limit - uint64_t(x - '0')) / 10)
+              throw "JSON parser error: Integer out of range.";
+            value = value * 10 + uint64_t(x - '0');
+          }
+          output.type = Field::Integer;
+          output.integer = negative ? -intmax_t(value - 1) - 1 : intmax_t(value);
+          return;
+        }
+
+        const double value = decimal_to_double(integer, fraction, exponent);
+        output.type = Field::Float;
+        output.real = negative ? -value : value;
+      }
+
+      constexpr void parse_primitive(static_node_t& output)
+      {
+        const std::size_t start = m_pos;
+        while(m_pos < m_json.size() && !is_primitive_end_char(m_json[m_pos]))
+          ++m_pos;
+
+        if(m_pos < m_json.size() && !is_space(m_json[m_pos]) && static_cast<unsigned char>(m_json[m_pos]) < 0x20)
+          throw "JSON parser error: Non-space control character found in primitive. Possibly an unquoted string.";
+
+        const std::string_view token = m_json.substr(start, m_pos - start);
+        if(token == "true")
+        {
+          output.type = Field::Boolean;
+          output.boolean = true;
+        }
+        else if(token == "false")
+        {
+          output.type = Field::Boolean;
+          output.boolean = false;
+        }
+        else if(token == "null")
+          output.type = Field::Null;
+        else
+          parse_number(output, token);
+      }
+
+      constexpr void parse_value(std::size_t identifier_offset, std::size_t identifier_length)
+      {
+        const std::size_t index = m_count++;
+        node(index).identifier_offset = identifier_offset;
+        node(index).identifier_length = identifier_length;
+
+        switch(peek())
+        {
+          case '[':
+          case '{':
+          {
+            const bool is_object = m_json[m_pos] == '{';
+            const char closing = is_object ? '}' : ']';
+            node(index).type = is_object ? Field::Object : Field::Array;
+            ++m_pos;
+            skip_whitespace();
+            while(peek() != closing) // an empty container or a trailing comma ends here
+            {
+              std::size_t offset = 0, length = 0;
+              if(is_object)
+              {
+                if(peek() != '"')
+                  throw "JSON parser error: Only a string can be a label.";
+                offset = m_length;
+                parse_string();
+                length = m_length - offset;
+                skip_whitespace();
+                if(peek() != ':')
+                  throw "JSON parser error: Expected ':' after label.";
+                ++m_pos;
+                skip_whitespace();
+              }
+              parse_value(offset, length);
+              skip_whitespace();
+              if(peek() == ',')
+              {
+                ++m_pos;
+                skip_whitespace();
+              }
+              else if(peek() != closing)
+                throw "JSON parser error: Expected ',' or closing bracket.";
+            }
+            ++m_pos; // skip closing bracket
+            break;
+          }
+
+          case '"':
+          {
+            const std::size_t offset = m_length;
+            parse_string();
+            node(index).type = Field::String;
+            node(index).string_offset = offset;
+            node(index).string_length = m_length - offset;
+            break;
+          }
+
+          case '\'':
+            throw "JSON parser error: Strings must use quotes, not apostrophes.";
+
+          default:
+            parse_primitive(node(index));
+            break;
+        }
+        node(index).end = m_count;
+      }
+
+      std::string_view m_json;
+      std::size_t m_pos;
+      std::size_t m_count;
+      std::size_t m_length;
+      static_node_t m_scratch;
+    };
+  }
+
+  constexpr std::size_t StaticNodeCount(std::string_view json_data)
+    { return detail::static_parser<0, 0>(json_data).parse(); }
+
+  template<std::size_t node_count, std::size_t string_capacity>
+  constexpr static_document_t<node_count, string_capacity> StaticParse(std::string_view json_data)
+  {
+    detail::static_parser<node_count, string_capacity> parser(json_data);
+    parser.parse();
+    return parser.document;
+  }
+
+  template<std::size_t N, std::size_t L>
+  constexpr bool FindNode(const static_document_t<N, L>& document, static_node_t& output, const std::string_view& identifier) noexcept
+  {
+    for(const static_node_t& node : document.nodes) // pre-order matches the search order of the runtime FindNode()
+      if(document.identifier(node) == identifier)
+        return output = node, true;
+    return false;
+  }
+
+  template<std::size_t N, std::size_t L>
+  constexpr bool FindString(const static_document_t<N, L>& document, std::string_view& output, const std::string_view& identifier) noexcept
+  {
+    static_node_t child;
+    return FindNode(document, child, identifier) &&
+        child.type == Field::String &&
+        (output = document.toString(child), true);
+  }
+
+  template<std::size_t N, std::size_t L>
+  constexpr bool FindNumber(const static_document_t<N, L>& document, intmax_t& output, const std::string_view& identifier) noexcept
+  {
+    static_node_t child;
+    return FindNode(document, child, identifier) &&
+        child.type == Field::Integer &&
+        (output = child.toNumber(), true);
+  }
+
+  template<std::size_t N, std::size_t L>
+  constexpr bool FindFloat(const static_document_t<N, L>& document, double& output, const std::string_view& identifier) noexcept
+  {
+    static_node_t child;
+    return FindNode(document, child, identifier) &&
+        child.type == Field::Float &&
+        (output = child.toFloat(), true);
+  }
+
+  template<std::size_t N, std::size_t L>
+  constexpr bool FindBoolean(const static_document_t<N, L>& document, bool& output, const std::string_view& identifier) noexcept
+  {
+    static_node_t child;
+    return FindNode(document, child, identifier) &&
+        child.type == Field::Boolean &&
+        (output = child.toBool(), true);
+  }
+}
+
+#endif // SHORTJSON_STATIC_H
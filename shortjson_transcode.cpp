@@ -0,0 +1,4 @@
+#include "shortjson_transcode_impl.h"
+
+SHORTJSON_TRANSCODE_INSTANTIATE(shortjson::strict_dialect);
+SHORTJSON_TRANSCODE_INSTANTIATE(shortjson::tolerant_dialect);
@@ -0,0 +1,20 @@
+#ifndef SHORTJSON_TRANSCODE_H
+#define SHORTJSON_TRANSCODE_H
+
+#include "shortjson.h"
+
+#include <iosfwd>
+
+namespace shortjson
+{
+  // Streams JSON of any dialect to 'output' as strict JSON without building a tree.  Strings and numbers that
+  // are already strict are copied as-is.  An 'indent' of zero minifies, otherwise it is the spaces per level.
+  template<typename dialect_t = default_dialect>
+  void Transcode(const std::string& json_data, std::ostream& output, unsigned int indent = 0);
+
+  // Same as above but 'input' is read in blocks, so memory only grows with the longest string or number.
+  template<typename dialect_t = default_dialect>
+  void Transcode(std::istream& input, std::ostream& output, unsigned int indent = 0);
+}
+
+#endif // SHORTJSON_TRANSCODE_H
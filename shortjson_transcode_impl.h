@@ -0,0 +1,424 @@
+#ifndef SHORTJSON_TRANSCODE_IMPL_H
+#define SHORTJSON_TRANSCODE_IMPL_H
+
+// Definitions of Transcode() for any dialect policy.  Only needed to instantiate
+// a dialect mix of your own, see SHORTJSON_TRANSCODE_INSTANTIATE at the end of this file.
+
+#include "shortjson_transcode.h"
+#include "shortjson_impl.h"
+
+#include <charconv>
+#include <istream>
+#include <ostream>
+
+namespace shortjson
+{
+  namespace detail
+  {
+    // writes a decoded string as a strict JSON string, copying runs that need no escaping in bulk
+    inline void write_string(std::string& output, const std::string& value)
+    {
+      output.push_back('"');
+      for(auto pos = value.begin(); pos != value.end(); )
+      {
+        auto run_end = std::find_if(pos, value.end(), [](char x) { return x == '"' || x == '\\' || uint8_t(x) < 0x20; });
+        output.append(pos, run_end);
+        if((pos = run_end) == value.end())
+          break;
+
+        switch(*pos)
+        {
+          case '"':  output.append("\\\"", 2); break;
+          case '\\': output.append("\\\\", 2); break;
+          case '\b': output.append("\\b", 2); break;
+          case '\f': output.append("\\f", 2); break;
+          case '\n': output.append("\\n", 2); break;
+          case '\r': output.append("\\r", 2); break;
+          case '\t': output.append("\\t", 2); break;
+          default:
+          {
+            static const char digits[] = "0123456789abcdef";
+            const char escape[] = { '\\', 'u', '0', '0', digits[uint8_t(*pos) >> 4], digits[uint8_t(*pos) & 0x0F] };
+            output.append(escape, sizeof(escape));
+            break;
+          }
+        }
+        ++pos;
+      }
+      output.push_back('"');
+    }
+
+    // true when the string at 'pos' is already a strict JSON string, 'string_end' is set to its closing quote
+    template <typename string_iterator>
+    inline bool is_strict_string(const string_iterator& pos, const string_iterator& end, string_iterator& string_end) noexcept
+    {
+      if(*pos != '"')
+        return false;
+
+      for(string_end = pos + 1; string_end < end && *string_end != '"'; ++string_end)
+      {
+        if(uint8_t(*string_end) < 0x20)
+          return false;
+        if(*string_end == '\\')
+        {
+          if(++string_end >= end)
+            return false;
+          switch(*string_end)
+          {
+            case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+              break;
+            case 'u':
+              if(end - string_end <= 4 || !std::all_of(string_end + 1, string_end + 5, ::isxdigit))
+                return false;
+              string_end += 4;
+              break;
+            default:
+              return false;
+          }
+        }
+      }
+      return string_end < end;
+    }
+
+    // true when 'token' is already a strict JSON number
+    inline bool is_strict_number(const std::string_view& token) noexcept
+    {
+      auto pos = token.begin() + (!token.empty() && token.front() == '-');
+      if(pos == token.end() || !std::isdigit(uint8_t(*pos)) || // must start with a digit
+         (*pos == '0' && pos + 1 != token.end() && std::isdigit(uint8_t(pos[1])))) // without leading zeros
+        return false;
+      pos = std::find_if_not(pos, token.end(), ::isdigit);
+      if(pos != token.end() && *pos == '.')
+      {
+        auto fraction_start = ++pos;
+        if((pos = std::find_if_not(pos, token.end(), ::isdigit)) == fraction_start) // digits must follow '.'
+          return false;
+      }
+      if(pos != token.end() && (*pos == 'e' || *pos == 'E'))
+      {
+        if(++pos != token.end() && (*pos == '+' || *pos == '-'))
+          ++pos;
+        auto exponent_start = pos;
+        if((pos = std::find_if_not(pos, token.end(), ::isdigit)) == exponent_start)
+          return false;
+      }
+      return pos == token.end();
+    }
+
+    // shortest text that std::stod() reads back as the same finite value, e.g. for hexadecimal floats
+    inline std::string float_text(double value)
+    {
+      char text[32];
+      const std::to_chars_result result = std::to_chars(text, text + sizeof(text), value);
+      return std::string(text, result.ptr);
+    }
+
+    // Input of the transcoder: either a whole document in memory or a stream that is read in blocks.  Consumed
+    // input is dropped from the block so only the token being transcoded has to fit in memory.
+    class transcoder_input
+    {
+    public:
+      transcoder_input(const std::string& data) noexcept : m_stream(nullptr), m_data(data), m_pos(0) { }
+      transcoder_input(std::istream& stream) : m_stream(&stream), m_pos(0) { m_block.reserve(block_size); }
+
+      // true when at least 'count' characters are left, reading more of the stream as needed
+      bool available(size_t count)
+      {
+        while(m_data.size() - m_pos < count)
+        {
+          if(m_stream == nullptr || !*m_stream)
+            return false;
+          m_block.erase(0, m_pos); // drop consumed input
+          m_pos = 0;
+          const size_t size = m_block.size();
+          m_block.resize(size + block_size);
+          m_stream->read(m_block.data() + size, std::streamsize(block_size));
+          m_block.resize(size + size_t(m_stream->gcount()));
+          m_data = m_block;
+        }
+        return true;
+      }
+
+      // skips spaces and returns false at the end of input
+      bool skip_space(void)
+      {
+        while(available(1) && is_space(m_data[m_pos]))
+          ++m_pos;
+        return available(1);
+      }
+
+      // length of the string starting at the current position, including both quotes
+      size_t string_length(void)
+      {
+        const char quote_char = m_data[m_pos];
+        for(size_t length = 1; available(length + 1); ++length)
+        {
+          if(m_data[m_pos + length] == '\\') // skip escaped character
+            ++length;
+          else if(m_data[m_pos + length] == quote_char)
+            return length + 1;
+        }
+        throw JSON_ERROR("Premature end of JSON found while processing string type.");
+      }
+
+      // length of the primitive starting at the current position
+      size_t primitive_length(void)
+      {
+        size_t length = 0;
+        while(available(length + 1) && !is_primitive_end_char(m_data[m_pos + length]))
+          ++length;
+        return length;
+      }
+
+      inline char peek(void) const noexcept { return m_data[m_pos]; }
+      inline const char* data(void) const noexcept { return m_data.data() + m_pos; }
+      inline void consume(size_t count) noexcept { m_pos += count; }
+
+    private:
+      static constexpr size_t block_size = 0x10000;
+
+      std::istream* m_stream;
+      std::string m_block;
+      std::string_view m_data; // whole document or m_block
+      size_t m_pos;
+    };
+
+    template <typename dialect_t>
+    class transcoder
+    {
+    public:
+      transcoder(transcoder_input& input, std::ostream& output, unsigned int indent)
+        : m_input(input), m_output(output), m_indent(indent), m_depth(0) { m_buffer.reserve(buffer_size); }
+
+      void flush(void)
+      {
+        m_output.write(m_buffer.data(), std::streamsize(m_buffer.size()));
+        m_buffer.clear();
+      }
+
+      void put(char x)
+      {
+        m_buffer.push_back(x);
+        flush_full();
+      }
+
+      void value(void)
+      {
+        if(!m_input.skip_space())
+          throw JSON_ERROR("Premature end of JSON found while transcoding a value.");
+
+        switch(m_input.peek())
+        {
+          case '[':
+          case '{':
+            container();
+            break;
+
+          case ']':
+          case '}':
+          case ',':
+          case ':':
+            throw JSON_ERROR("Expected a value.");
+
+          case '\'':
+            if constexpr(!dialect_t::apostrophe_quotes)
+              throw JSON_ERROR("Strings must use quotes, not apostrophes.");
+            [[fallthrough]];
+          case '"':
+            string();
+            break;
+
+          default:
+            primitive();
+            break;
+        }
+      }
+
+    private:
+      static constexpr size_t buffer_size = 0x10000; // output is written in blocks so that memory stays bounded
+
+      void flush_full(void)
+      {
+        if(m_buffer.size() >= buffer_size)
+          flush();
+      }
+
+      void write(const char* data, size_t length)
+      {
+        m_buffer.append(data, length);
+        flush_full();
+      }
+
+      void newline(void)
+      {
+        if(m_indent == 0)
+          return;
+        put('\n');
+        for(size_t spaces = m_depth * m_indent; spaces > 0; --spaces)
+          put(' ');
+      }
+
+      void string(void)
+      {
+        const size_t length = m_input.string_length();
+        const char* pos = m_input.data();
+        const char* const end = pos + length;
+        const char* string_end = nullptr;
+        if(is_strict_string(pos, end, string_end)) // copy unchanged
+          write(pos, length);
+        else // decode and rewrite
+        {
+          parse_string<dialect_t>(m_scratch, pos, end);
+          write_string(m_buffer, m_scratch.toString());
+          flush_full();
+        }
+        m_input.consume(length);
+      }
+
+      void primitive(void)
+      {
+        const size_t length = m_input.primitive_length();
+        if(m_input.available(length + 1) && !is_space(m_input.data()[length]) && is_control(m_input.data()[length]))
+          throw JSON_ERROR("Non-space control character found in primitive. Possibly an unquoted string.");
+
+        const std::string_view token(m_input.data(), length);
+        m_input.consume(length);
+        if(token == "true" || token == "false" || token == "null" || is_strict_number(token)) // copy unchanged
+        {
+          write(token.data(), token.size());
+          return;
+        }
+
+        std::string value(token);
+        if constexpr(dialect_t::case_insensitive_literals)
+          std::transform(value.begin(), value.end(), value.begin(), ::tolower);
+
+        if(value == "true" || value == "false" || value == "null")
+          write(value.data(), value.size());
+        else if(std::isalpha(uint8_t(value.front())) && !(dialect_t::special_floats && is_special_float(value)))
+          throw JSON_ERROR("Unrecognized primitive type.\n"
+                           "  * Strings must use quotes.\n"
+                           "  * Boolean and null values must be lowercase.");
+        else
+        {
+          int base = 10;
+          const Field type = prepare_number<dialect_t>(value, base); // validates and removes separators and '+'
+          if(base != 10) // hexadecimal or octal
+            value = type == Field::Float ? float_text(std::stod(value)) : std::to_string(to_integer(value, base));
+          else
+          {
+            const size_t sign = value.front() == '-';
+            while(value.size() > sign + 1 && value[sign] == '0' && std::isdigit(uint8_t(value[sign + 1]))) // "00.5" -> "0.5"
+              value.erase(sign, 1);
+            if(value[sign] == '.') // ".5" -> "0.5"
+              value.insert(sign, 1, '0');
+            size_t dot = value.find('.');
+            if(dot != std::string::npos && (dot + 1 == value.size() || !std::isdigit(uint8_t(value[dot + 1])))) // "5." -> "5.0"
+              value.insert(dot + 1, 1, '0');
+          }
+          if(type == Field::Float && value.find_first_of(".eE") == std::string::npos) // "08" -> "8.0" stays a float
+            value.append(".0");
+
+          if(!is_strict_number(value))
+            throw JSON_ERROR("Number cannot be written as strict JSON.");
+          write(value.data(), value.size());
+        }
+      }
+
+      void container(void)
+      {
+        const bool is_object = m_input.peek() == '{';
+        const char closing = is_object ? '}' : ']';
+        bool empty = true;
+        bool separated = true; // the opening bracket acts as a separator
+
+        put(m_input.peek());
+        m_input.consume(1);
+        ++m_depth;
+        for(;;)
+        {
+          if(!m_input.skip_space())
+            throw JSON_ERROR("Premature end of JSON found while transcoding a value.");
+          if(m_input.peek() == closing)
+            break;
+          if(m_input.peek() == ',') // separators are written before each value, which also drops trailing commas
+          {
+            if(separated)
+              throw JSON_ERROR("Expected a value before ','.");
+            separated = true;
+            m_input.consume(1);
+            continue;
+          }
+
+          if(!separated)
+            throw JSON_ERROR("Expected ',' between values.");
+          separated = false;
+          if(!empty)
+            put(',');
+          empty = false;
+          newline();
+
+          if(is_object)
+          {
+            if(m_input.peek() != '"' && !(dialect_t::apostrophe_quotes && m_input.peek() == '\''))
+              throw JSON_ERROR("Only a string can be a label.");
+            string();
+            if(!m_input.skip_space() || m_input.peek() != ':')
+              throw JSON_ERROR("Expected ':' after label.");
+            m_input.consume(1);
+            put(':');
+            if(m_indent != 0)
+              put(' ');
+          }
+          value();
+        }
+        m_input.consume(1);
+        --m_depth;
+        if(!empty)
+          newline();
+        put(closing);
+      }
+
+      transcoder_input& m_input;
+      std::ostream& m_output;
+      std::string m_buffer;
+      unsigned int m_indent;
+      size_t m_depth;
+      node_t m_scratch;
+    };
+
+    template <typename dialect_t>
+    inline void transcode(transcoder_input& input, std::ostream& output, unsigned int indent)
+    {
+      transcoder<dialect_t> writer(input, output, indent);
+      for(bool first = true; input.skip_space(); first = false) // a sequence of values is written one per line
+      {
+        if(!first)
+          writer.put('\n');
+        writer.value();
+      }
+      writer.flush();
+    }
+  }
+
+  template<typename dialect_t>
+  void Transcode(const std::string& json_data, std::ostream& output, unsigned int indent)
+  {
+    detail::transcoder_input input(json_data);
+    detail::transcode<dialect_t>(input, output, indent);
+  }
+
+  template<typename dialect_t>
+  void Transcode(std::istream& input, std::ostream& output, unsigned int indent)
+  {
+    detail::transcoder_input blocks(input);
+    detail::transcode<dialect_t>(blocks, output, indent);
+  }
+}
+
+// Instantiates both Transcode() overloads for a dialect, see SHORTJSON_INSTANTIATE.
+#define SHORTJSON_TRANSCODE_INSTANTIATE(dialect) \
+  template void shortjson::Transcode<dialect>(const std::string& json_data, std::ostream& output, unsigned int indent); \
+  template void shortjson::Transcode<dialect>(std::istream& input, std::ostream& output, unsigned int indent)
+
+#endif // SHORTJSON_TRANSCODE_IMPL_H
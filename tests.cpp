@@ -1,8 +1,27 @@
 #include <cassert>
+#include <cmath>
 #include <string>
 #include <iostream>
+#include <sstream>
 
 #include "shortjson.h"
+#include "shortjson_impl.h"
+#include "shortjson_static.h"
+#include "shortjson_patch.h"
+#include "shortjson_shared.h"
+#include "shortjson_filter.h"
+#include "shortjson_hash.h"
+#include "shortjson_schema.h"
+#include "shortjson_transcode_impl.h"
+
+
+// dialect mix that is instantiated outside of the library
+struct separated_dialect : shortjson::strict_dialect
+{
+  static constexpr bool digit_separators = true;
+};
+SHORTJSON_INSTANTIATE(separated_dialect);
+SHORTJSON_TRANSCODE_INSTANTIATE(separated_dialect);
 
 
 template<typename T> std::string_view get_value(shortjson::node_t&, T&) { assert(false); return "this shouldn't be reached"; }
@@ -40,19 +59,26 @@ template<> std::string_view get_value<std::nullptr_t>(shortjson::node_t&, std::n
 }
 
 
-template<typename T>
-void parse_test(std::string test, T expected_value)
+template<typename T> struct test_value { using type = T; };
+template<> struct test_value<const char*> { using type = std::string; };
+template<> struct test_value<int> { using type = intmax_t; };
+template<> struct test_value<float> { using type = double; };
+
+template<typename dialect_t, typename T>
+void parse_test(std::string test, T expected)
 {
   std::cout << std::endl;
 
-  shortjson::node_t root = shortjson::Parse(test);
+  typename test_value<T>::type expected_value = expected;
+  shortjson::node_t root = shortjson::Parse<dialect_t>(test);
   shortjson::node_t& node = root.toObject().front();
 
   std::cout << "test identifier: " << node.identifier << std::endl;
-  T value;
+  typename test_value<T>::type value;
   std::string_view type = get_value(node, value);
 
-  if(value != expected_value)
+  if(value != expected_value &&
+     !(value != value && expected_value != expected_value)) // NaN
   {
     std::cout << "Parsing string:" << std::endl
               << test << std::endl;
@@ -67,35 +93,289 @@ void parse_test(std::string test, T expected_value)
   std::cout << "Test: PASSED" << std::endl;
 }
 
-template<>
-void parse_test<const char*>(std::string test, const char* expected_value)
-  { parse_test(test, std::string(expected_value)); }
 
-template<>
-void parse_test<int>(std::string test, int expected_value)
-  { parse_test(test, intmax_t(expected_value)); }
+// passes when 'test' throws a const char* error message
+template<typename callable_t>
+void error_test(std::string test_id, callable_t test)
+{
+  std::cout << std::endl;
 
-template<>
-void parse_test<float>(std::string test, float expected_value)
-  { parse_test(test, double(expected_value)); }
+  std::cout << "test identifier: " << test_id << std::endl;
+  bool failed = false;
+  try
+  {
+    test();
+  }
+  catch(const char* message)
+  {
+    failed = true;
+  }
 
+  if(!failed)
+  {
+    std::cout << "Test: FAILED" << std::endl;
+    throw "test failed";
+  }
+  std::cout << "Test: PASSED" << std::endl;
+}
 
+template<typename dialect_t>
 void parser_error_test(std::string test, std::string test_id)
+  { error_test(test_id, [&test] { shortjson::Parse<dialect_t>(test); }); }
+
+
+constexpr auto static_test_document = SHORTJSON_STATIC_PARSE(R"({
+  "name" : "static \u263a",
+  "port" : 8080,
+  "offset" : -4096,
+  "ratio" : -409600000.004096,
+  "small" : 4.096e-3,
+  "enabled" : true,
+  "nothing" : null,
+  "list" : [ 1, 2, { "nested" : false }, ]
+})");
+
+constexpr bool static_find_test(void)
+{
+  std::string_view name;
+  intmax_t port = 0, offset = 0;
+  double ratio = 0.0, small = 0.0;
+  bool enabled = false, nested = true;
+  shortjson::static_node_t node;
+  return shortjson::FindString(static_test_document, name, "name") && name == "static \xE2\x98\xBA" &&
+         shortjson::FindNumber(static_test_document, port, "port") && port == 8080 &&
+         shortjson::FindNumber(static_test_document, offset, "offset") && offset == -4096 &&
+         shortjson::FindFloat(static_test_document, ratio, "ratio") && ratio == -409600000.004096 &&
+         shortjson::FindFloat(static_test_document, small, "small") && small == 0.004096 &&
+         shortjson::FindBoolean(static_test_document, enabled, "enabled") && enabled &&
+         shortjson::FindBoolean(static_test_document, nested, "nested") && !nested &&
+         shortjson::FindNode(static_test_document, node, "nothing") && node.type == shortjson::Field::Null &&
+         shortjson::FindNode(static_test_document, node, "list") && node.type == shortjson::Field::Array &&
+         !shortjson::FindNumber(static_test_document, port, "name") &&
+         !shortjson::FindNode(static_test_document, node, "missing");
+}
+static_assert(static_test_document.nodes.size() == 13, "static document node count");
+static_assert(static_find_test(), "static document lookups");
+
+// compile time floats must match the runtime parser bit for bit
+void static_float_test(void)
+{
+  std::cout << std::endl;
+
+  std::cout << "test identifier: static floats" << std::endl;
+  constexpr auto document = SHORTJSON_STATIC_PARSE("[ 1.7976931348623157e308, 9007199254740993.0, 0.1, 2.2250738585072014e-308, 123456789012345678901234567890e-10, 0.30000000000000000000000000000000000000000001 ]");
+  const shortjson::node_t runtime = shortjson::Parse<shortjson::strict_dialect>("[ 1.7976931348623157e308, 9007199254740993.0, 0.1, 2.2250738585072014e-308, 123456789012345678901234567890e-10, 0.30000000000000000000000000000000000000000001 ]");
+
+  for(size_t index = 0; index < runtime.toArray().size(); ++index)
+    if(document.nodes[index + 1].toFloat() != runtime.toArray()[index].toFloat())
+    {
+      std::cout << "Value   : " << document.nodes[index + 1].toFloat() << std::endl;
+      std::cout << "Expected: " << runtime.toArray()[index].toFloat() << std::endl;
+      std::cout << "Test: FAILED" << std::endl;
+      throw "test failed";
+    }
+  std::cout << "Test: PASSED" << std::endl;
+}
+
+void patch_test(std::string test_id, std::string document, std::string patch, std::string expected, bool merge = false)
 {
   std::cout << std::endl;
 
   std::cout << "test identifier: " << test_id << std::endl;
-  try
+  shortjson::node_t root = shortjson::Parse(document);
+  const shortjson::node_t original = root;
+  const shortjson::node_t result = shortjson::Parse(expected);
+
+  if(merge)
+    shortjson::ApplyMergePatch(root, shortjson::Parse(patch));
+  else
+    shortjson::ApplyPatch(root, shortjson::Parse(patch));
+
+  shortjson::node_t roundtrip = original;
+  shortjson::ApplyPatch(roundtrip, shortjson::Diff(original, result)); // the generated patch must reproduce the expected result
+
+  if(root != result ||
+     roundtrip != result ||
+     !shortjson::Diff(result, result).toArray().empty())
+  {
+    std::cout << "Patching document:" << std::endl
+              << document << std::endl
+              << "with:" << std::endl
+              << patch << std::endl;
+    std::cout << "Test: FAILED" << std::endl;
+    throw "test failed";
+  }
+  std::cout << "Test: PASSED" << std::endl;
+}
+
+// applies 'patch' to 'document' when called by error_test()
+auto patching(std::string document, std::string patch)
+{
+  return [document, patch]
+  {
+    shortjson::node_t root = shortjson::Parse(document);
+    shortjson::ApplyPatch(root, shortjson::Parse(patch));
+  };
+}
+
+void shared_test(void)
+{
+  std::cout << std::endl;
+
+  std::cout << "test identifier: shared document" << std::endl;
+  const shortjson::shared_node_t original(shortjson::Parse(R"({ "name" : "config", "limits" : { "low" : 1, "high" : 2 }, "list" : [ 1, 2, 3 ] })"));
+  const shortjson::shared_node_t copy = original;
+
+  shortjson::shared_node_t limits;
+  std::string name;
+  intmax_t number = 0;
+  const shortjson::shared_node_t modified = original.with("name", shortjson::shared_node_t(shortjson::Parse("[ \"renamed\" ]")).toArray().front())
+                                                    .without("list");
+
+  if(!copy.shares(original) ||
+     !shortjson::FindNode(original, limits, "limits") ||
+     !limits.shares(original.toObject()[1]) || // sub-document extraction shares the subtree
+     !modified.toObject()[1].shares(limits) || // unchanged subtree is shared by the modified copy
+     modified.toObject().size() != 2 ||
+     !shortjson::FindString(modified, name, "name") || name != "renamed" ||
+     !shortjson::FindString(original, name, "name") || name != "config" ||
+     !shortjson::FindNumber(original.toObject()[2].with(1, limits), number, "high") || number != 2 ||
+     original.toNode() != shortjson::Parse(R"({ "name" : "config", "limits" : { "low" : 1, "high" : 2 }, "list" : [ 1, 2, 3 ] })"))
+  {
+    std::cout << "Test: FAILED" << std::endl;
+    throw "test failed";
+  }
+
+  const shortjson::shared_node_t nested = original.with({ "limits", "high" }, original.toObject()[2].toArray()[2]) // path copying
+                                                  .with({ "list", "0" }, limits)
+                                                  .without({ "list", "1" })
+                                                  .without({ "limits", "low" });
+  const shortjson::shared_node_t undefined;
+
+  if(nested.toNode() != shortjson::Parse(R"({ "name" : "config", "limits" : { "high" : 3 }, "list" : [ { "low" : 1, "high" : 2 }, 3 ] })") ||
+     !nested.toObject()[0].shares(original.toObject()[0]) || // untouched members are shared
+     !nested.toObject()[2].toArray()[0].toObject()[0].shares(limits.toObject()[0]) || // renamed copies share their children
+     !nested.toObject()[2].toArray()[1].shares(original.toObject()[2].toArray()[2]) ||
+     original.toNode() != shortjson::Parse(R"({ "name" : "config", "limits" : { "low" : 1, "high" : 2 }, "list" : [ 1, 2, 3 ] })") ||
+     shortjson::Hash(original) != shortjson::Hash(original.toNode()) ||
+     shortjson::Hash(nested) != shortjson::Hash(nested.toNode()) || // reuses the cached hashes of shared subtrees
+     !undefined.toArray().empty() || !undefined.toString().empty() || undefined.toNumber() != 0)
+  {
+    std::cout << "Test: FAILED" << std::endl;
+    throw "test failed";
+  }
+  std::cout << "Test: PASSED" << std::endl;
+}
+
+void filter_test(std::string test_id, std::string records, const shortjson::filter_t& filter, std::string expected)
+{
+  std::cout << std::endl;
+
+  std::cout << "test identifier: " << test_id << std::endl;
+  if(shortjson::ParseFiltered(records, filter) != shortjson::Parse(expected))
   {
-    shortjson::node_t root = shortjson::Parse(test);
+    std::cout << "Filtering records:" << std::endl
+              << records << std::endl;
     std::cout << "Test: FAILED" << std::endl;
+    throw "test failed";
+  }
+  std::cout << "Test: PASSED" << std::endl;
+}
+
+template<typename dialect_t>
+void equality_test(std::string test_id, std::string a, std::string b, bool expected)
+{
+  std::cout << std::endl;
+
+  std::cout << "test identifier: " << test_id << std::endl;
+  const shortjson::node_t left = shortjson::Parse<dialect_t>(a);
+  const shortjson::node_t right = shortjson::Parse<dialect_t>(b);
+  const bool hashes_match = shortjson::Hash(left) == shortjson::Hash(right);
+
+  shortjson::hash_builder_t builder(left.type); // combining the children's hashes must give the same hash
+  if(left.type == shortjson::Field::Array || left.type == shortjson::Field::Object)
+    for(const shortjson::node_t& child : left.toArray())
+      builder.add(child.identifier, shortjson::Hash(child));
+
+  if((left == right) != expected ||
+     (expected && !hashes_match) || // equal values must hash equally
+     (!expected && hashes_match) || // not guaranteed, but expected for these small inputs
+     std::hash<shortjson::node_t>()(left) != size_t(shortjson::Hash(left)) ||
+     shortjson::Hash<dialect_t>(a) != shortjson::Hash(left) || // hashing text matches hashing the tree
+     shortjson::Hash<dialect_t>(b) != shortjson::Hash(right) ||
+     ((left.type == shortjson::Field::Array || left.type == shortjson::Field::Object) && builder.finish() != shortjson::Hash(left)) ||
+     shortjson::Hash(shortjson::shared_node_t(left)) != shortjson::Hash(left))
+  {
+    std::cout << "Comparing:" << std::endl
+              << a << std::endl
+              << b << std::endl;
+    std::cout << "Test: FAILED" << std::endl;
+    throw "test failed";
+  }
+  std::cout << "Test: PASSED" << std::endl;
+}
+
+void schema_test(std::string test_id, const shortjson::schema_t& schema, std::string test, bool valid)
+{
+  std::cout << std::endl;
+
+  std::cout << "test identifier: " << test_id << std::endl;
+  bool passed = true;
+  try
+  {
+    shortjson::node_t root = shortjson::Parse(test, schema);
+    passed = valid && root == shortjson::Parse(test);
   }
   catch(const char* message)
   {
-    std::cout << "Test: PASSED" << std::endl;
+    passed = !valid;
+  }
+
+  if(!passed)
+  {
+    std::cout << "Validating:" << std::endl
+              << test << std::endl;
+    std::cout << "Test: FAILED" << std::endl;
+    throw "test failed";
   }
+  std::cout << "Test: PASSED" << std::endl;
 }
 
+// 'parseable' is false when the input has integers that the parser cannot hold
+template<typename dialect_t>
+void transcode_test(std::string test_id, std::string test, std::string expected, unsigned int indent = 0, bool parseable = true)
+{
+  std::cout << std::endl;
+
+  std::cout << "test identifier: " << test_id << std::endl;
+  std::ostringstream output, streamed;
+  shortjson::Transcode<dialect_t>(test, output, indent);
+  std::istringstream input(test);
+  shortjson::Transcode<dialect_t>(input, streamed, indent);
+
+  if(output.str() != expected ||
+     streamed.str() != expected ||
+     (parseable && shortjson::Parse<shortjson::strict_dialect>(output.str()) != shortjson::Parse<dialect_t>(test))) // output must be strict and mean the same
+  {
+    std::cout << "Transcoding:" << std::endl
+              << test << std::endl;
+    std::cout << "Output  : " << output.str() << std::endl;
+    std::cout << "Expected: " << expected << std::endl;
+    std::cout << "Test: FAILED" << std::endl;
+    throw "test failed";
+  }
+  std::cout << "Test: PASSED" << std::endl;
+}
+
+// transcodes strict 'test' when called by error_test()
+auto transcoding(std::string test)
+{
+  return [test]
+  {
+    std::ostringstream output;
+    shortjson::Transcode<shortjson::strict_dialect>(test, output);
+  };
+}
 
 
 int main(int argc, char* argv[])
@@ -103,96 +383,254 @@ int main(int argc, char* argv[])
   // NOTE: unicode/hex/octal escape sequences generated with https://onlineunicodetools.com/escape-unicode
   try
   {
-#ifndef TOLERANT_JSON
-    parse_test("{\"normal quoted string\" : \"string\" }", "string");
-    parser_error_test("{\"EMCAScript quoted string\" : 'string' }", "EMCAScript quoted string");
-
-    parser_error_test("{\"bad boolean true 1\" : TRUE }", "bad boolean true 1");
-    parser_error_test("{\"bad boolean true 2\" : True }", "bad boolean true 2");
-    parse_test("{\"good boolean true\" : true }", true);
-
-    parser_error_test("{\"bad boolean false 1\" : FALSE }", "bad boolean false 1");
-    parser_error_test("{\"bad boolean false 2\" : False }", "bad boolean false 2");
-    parse_test("{\"good boolean false\" : false }", false);
-
-    parser_error_test("{\"bad null 1\" : NULL }", "bad null 1");
-    parser_error_test("{\"bad null 2\" : Null }", "bad null 2");
-    parse_test("{\"good null\" : null }", nullptr);
-
-    parse_test("{\"unescaped UTF-16\" : \"Hello World! ☺\"}", "Hello World! ☺");
-    parse_test("{\"escaped UTF-16\" : \"\\u0048\\u0065\\u006c\\u006c\\u006f\\u0020\\u0057\\u006f\\u0072\\u006c\\u0064\\u0021\\u0020\\u263a\"}", "Hello World! ☺");
-    parse_test("{\"escaped hexadecimal\" : \"\\x48\\x65\\x6c\\x6c\\x6f\\x20\\x57\\x6f\\x72\\x6c\\x64\\x21\\x20☺\"}", "\\x48\\x65\\x6c\\x6c\\x6f\\x20\\x57\\x6f\\x72\\x6c\\x64\\x21\\x20☺");
-    parse_test("{\"unpadded octal\" : \"\\110\\145\\154\\154\\157\\40\\127\\157\\162\\154\\144\\41\\40☺\" }", "\\110\\145\\154\\154\\157\\40\\127\\157\\162\\154\\144\\41\\40☺");
-    parse_test("{\"padded octal\" : \"\\110\\145\\154\\154\\157\\040\\127\\157\\162\\154\\144\\041\\040☺\" }", "\\110\\145\\154\\154\\157\\040\\127\\157\\162\\154\\144\\041\\040☺");
-
-    parse_test("{\"signless integer\" : 4096 }", 4096);
-    parser_error_test("{\"explicitly positive integer\" : +4096 }", "explicitly positive integer");
-    parse_test("{\"negative integer\" : -4096 }", -4096);
-    parser_error_test("{\"signless hexadecimal integer\" : 0x1000 }", "signless hexadecimal integer");
-    parser_error_test("{\"explicitly positive hexadecimal integer\" : +0x1000 }", "explicitly positive hexadecimal integer");
-    parser_error_test("{\"negative hexadecimal integer\" : -0x1000 }", "negative hexadecimal integer");
-
-    parse_test("{\"signless float\" : 409600000.004096 }", 409600000.004096);
-    parser_error_test("{\"explicitly positive float\" : +409600000.004096 }", "explicitly positive float");
-    parse_test("{\"negative float\" : -409600000.004096 }", -409600000.004096);
-
-    parse_test("{\"signless scientific large float\" : 4.096e+10 }", 40960000000.000000);
-    parse_test("{\"signless scientific normal float\" : 4.096e+3 }", 4096.000000);
-    parse_test("{\"signless scientific small float\" : 4.096e-3 }", 0.004096);
-
-    parser_error_test("{\"explicitly positive scientific large float\" : +4.096e+10 }",  "explicitly positive scientific large float");
-    parser_error_test("{\"explicitly positive scientific normal float\" : +4.096e+3 }", "explicitly positive scientific normal float");
-    parser_error_test("{\"explicitly positive scientific small float\" : +4.096e-3 }", "explicitly positive scientific small float");
-
-    parse_test("{\"negative scientific large float\" : -4.096e+10 }", -40960000000.000000);
-    parse_test("{\"negative scientific normal float\" : -4.096e+3 }", -4096.000000);
-    parse_test("{\"negative scientific small float\" : -4.096e-3 }", -0.004096);
-#else
-    parse_test("{\"normal quoted string\" : \"string\" }", "string");
-    parse_test("{\"EMCAScript quoted string\" : 'string' }", "string");
-
-    parse_test("{'bad boolean true 1' : TRUE }", true);
-    parse_test("{'bad boolean true 2' : True }", true);
-    parse_test("{'good boolean true' : true }", true);
-
-    parse_test("{'bad boolean false 1' : FALSE }", false);
-    parse_test("{'bad boolean false 2' : False }", false);
-    parse_test("{'good boolean false' : false }", false);
-
-    parse_test("{'bad null 1' : NULL }", nullptr);
-    parse_test("{'bad null 2' : Null }", nullptr);
-    parse_test("{'good null' : null }", nullptr);
-
-    parse_test("{'unescaped UTF-16' : 'Hello World! ☺'}", "Hello World! ☺");
-    parse_test("{'escaped UTF-16' : '\\u0048\\u0065\\u006c\\u006c\\u006f\\u0020\\u0057\\u006f\\u0072\\u006c\\u0064\\u0021\\u0020\\u263a'}", "Hello World! ☺");
-    parse_test("{'escaped hexadecimal' : '\\x48\\x65\\x6c\\x6c\\x6f\\x20\\x57\\x6f\\x72\\x6c\\x64\\x21\\x20☺'}", "Hello World! ☺");
-    parse_test("{'unpadded octal' : '\\110\\145\\154\\154\\157\\40\\127\\157\\162\\154\\144\\41\\40☺' }", "Hello World! ☺");
-    parse_test("{'padded octal' : '\\110\\145\\154\\154\\157\\040\\127\\157\\162\\154\\144\\041\\040☺' }", "Hello World! ☺");
-
-    parse_test("{'signless integer' : 4096 }", 4096);
-    parse_test("{'explicitly positive integer' : +4096 }", 4096);
-    parse_test("{'negative integer' : -4096 }", -4096);
-    parse_test("{'signless hexadecimal integer' : 0x1000 }", 4096);
-    parse_test("{'explicitly positive hexadecimal integer' : +0x1000 }", 4096);
-    parse_test("{'negative hexadecimal integer' : -0x1000 }", -4096);
-
-    parse_test("{'signless float' : 409600000.004096 }", 409600000.004096);
-    parse_test("{'explicitly positive float' : +409600000.004096 }", 409600000.004096);
-    parse_test("{'negative float' : -409600000.004096 }", -409600000.004096);
-
-    parse_test("{'signless scientific large float' : 4.096e+10 }", 40960000000.000000);
-    parse_test("{'signless scientific normal float' : 4.096e+3 }", 4096.000000);
-    parse_test("{'signless scientific small float' : 4.096e-3 }", 0.004096);
-
-    parse_test("{'explicitly positive scientific large float' : +4.096e+10 }",  40960000000.000000);
-    parse_test("{'explicitly positive scientific normal float' : +4.096e+3 }", 4096.000000);
-    parse_test("{'explicitly positive scientific small float' : +4.096e-3 }", 0.004096);
-
-    parse_test("{'negative scientific large float' : -4.096e+10 }", -40960000000.000000);
-    parse_test("{'negative scientific normal float' : -4.096e+3 }", -4096.000000);
-    parse_test("{'negative scientific small float' : -4.096e-3 }", -0.004096);
-#endif
-
+    parse_test<shortjson::strict_dialect>("{\"normal quoted string\" : \"string\" }", "string");
+    parser_error_test<shortjson::strict_dialect>("{\"EMCAScript quoted string\" : 'string' }", "EMCAScript quoted string");
+
+    parser_error_test<shortjson::strict_dialect>("{\"bad boolean true 1\" : TRUE }", "bad boolean true 1");
+    parser_error_test<shortjson::strict_dialect>("{\"bad boolean true 2\" : True }", "bad boolean true 2");
+    parse_test<shortjson::strict_dialect>("{\"good boolean true\" : true }", true);
+
+    parser_error_test<shortjson::strict_dialect>("{\"bad boolean false 1\" : FALSE }", "bad boolean false 1");
+    parser_error_test<shortjson::strict_dialect>("{\"bad boolean false 2\" : False }", "bad boolean false 2");
+    parse_test<shortjson::strict_dialect>("{\"good boolean false\" : false }", false);
+
+    parser_error_test<shortjson::strict_dialect>("{\"bad null 1\" : NULL }", "bad null 1");
+    parser_error_test<shortjson::strict_dialect>("{\"bad null 2\" : Null }", "bad null 2");
+    parse_test<shortjson::strict_dialect>("{\"good null\" : null }", nullptr);
+
+    parse_test<shortjson::strict_dialect>("{\"unescaped UTF-16\" : \"Hello World! ☺\"}", "Hello World! ☺");
+    parse_test<shortjson::strict_dialect>("{\"escaped UTF-16\" : \"\\u0048\\u0065\\u006c\\u006c\\u006f\\u0020\\u0057\\u006f\\u0072\\u006c\\u0064\\u0021\\u0020\\u263a\"}", "Hello World! ☺");
+    parse_test<shortjson::strict_dialect>("{\"escaped hexadecimal\" : \"\\x48\\x65\\x6c\\x6c\\x6f\\x20\\x57\\x6f\\x72\\x6c\\x64\\x21\\x20☺\"}", "\\x48\\x65\\x6c\\x6c\\x6f\\x20\\x57\\x6f\\x72\\x6c\\x64\\x21\\x20☺");
+    parse_test<shortjson::strict_dialect>("{\"unpadded octal\" : \"\\110\\145\\154\\154\\157\\40\\127\\157\\162\\154\\144\\41\\40☺\" }", "\\110\\145\\154\\154\\157\\40\\127\\157\\162\\154\\144\\41\\40☺");
+    parse_test<shortjson::strict_dialect>("{\"padded octal\" : \"\\110\\145\\154\\154\\157\\040\\127\\157\\162\\154\\144\\041\\040☺\" }", "\\110\\145\\154\\154\\157\\040\\127\\157\\162\\154\\144\\041\\040☺");
+
+    parse_test<shortjson::strict_dialect>("{\"escaped quote\" : \"\\\"quoted\\\"\" }", "\"quoted\"");
+
+    parse_test<shortjson::strict_dialect>("{\"signless integer\" : 4096 }", 4096);
+    parser_error_test<shortjson::strict_dialect>("{\"separated integer\" : 4_096 }", "separated integer");
+    parser_error_test<shortjson::strict_dialect>("{\"explicitly positive integer\" : +4096 }", "explicitly positive integer");
+    parse_test<shortjson::strict_dialect>("{\"negative integer\" : -4096 }", -4096);
+    parser_error_test<shortjson::strict_dialect>("{\"signless hexadecimal integer\" : 0x1000 }", "signless hexadecimal integer");
+    parser_error_test<shortjson::strict_dialect>("{\"explicitly positive hexadecimal integer\" : +0x1000 }", "explicitly positive hexadecimal integer");
+    parser_error_test<shortjson::strict_dialect>("{\"negative hexadecimal integer\" : -0x1000 }", "negative hexadecimal integer");
+
+    parse_test<shortjson::strict_dialect>("{\"signless float\" : 409600000.004096 }", 409600000.004096);
+    parser_error_test<shortjson::strict_dialect>("{\"explicitly positive float\" : +409600000.004096 }", "explicitly positive float");
+    parse_test<shortjson::strict_dialect>("{\"negative float\" : -409600000.004096 }", -409600000.004096);
+
+    parse_test<shortjson::strict_dialect>("{\"signless scientific large float\" : 4.096e+10 }", 40960000000.000000);
+    parse_test<shortjson::strict_dialect>("{\"signless scientific normal float\" : 4.096e+3 }", 4096.000000);
+    parse_test<shortjson::strict_dialect>("{\"signless scientific small float\" : 4.096e-3 }", 0.004096);
+
+    parser_error_test<shortjson::strict_dialect>("{\"explicitly positive scientific large float\" : +4.096e+10 }",  "explicitly positive scientific large float");
+    parser_error_test<shortjson::strict_dialect>("{\"explicitly positive scientific normal float\" : +4.096e+3 }", "explicitly positive scientific normal float");
+    parser_error_test<shortjson::strict_dialect>("{\"explicitly positive scientific small float\" : +4.096e-3 }", "explicitly positive scientific small float");
+
+    parse_test<shortjson::strict_dialect>("{\"negative scientific large float\" : -4.096e+10 }", -40960000000.000000);
+    parse_test<shortjson::strict_dialect>("{\"negative scientific normal float\" : -4.096e+3 }", -4096.000000);
+    parse_test<shortjson::strict_dialect>("{\"negative scientific small float\" : -4.096e-3 }", -0.004096);
+
+    parse_test<shortjson::tolerant_dialect>("{\"normal quoted string\" : \"string\" }", "string");
+    parse_test<shortjson::tolerant_dialect>("{\"EMCAScript quoted string\" : 'string' }", "string");
+
+    parse_test<shortjson::tolerant_dialect>("{'bad boolean true 1' : TRUE }", true);
+    parse_test<shortjson::tolerant_dialect>("{'bad boolean true 2' : True }", true);
+    parse_test<shortjson::tolerant_dialect>("{'good boolean true' : true }", true);
+
+    parse_test<shortjson::tolerant_dialect>("{'bad boolean false 1' : FALSE }", false);
+    parse_test<shortjson::tolerant_dialect>("{'bad boolean false 2' : False }", false);
+    parse_test<shortjson::tolerant_dialect>("{'good boolean false' : false }", false);
+
+    parse_test<shortjson::tolerant_dialect>("{'bad null 1' : NULL }", nullptr);
+    parse_test<shortjson::tolerant_dialect>("{'bad null 2' : Null }", nullptr);
+    parse_test<shortjson::tolerant_dialect>("{'good null' : null }", nullptr);
+
+    parse_test<shortjson::tolerant_dialect>("{'unescaped UTF-16' : 'Hello World! ☺'}", "Hello World! ☺");
+    parse_test<shortjson::tolerant_dialect>("{'escaped UTF-16' : '\\u0048\\u0065\\u006c\\u006c\\u006f\\u0020\\u0057\\u006f\\u0072\\u006c\\u0064\\u0021\\u0020\\u263a'}", "Hello World! ☺");
+    parse_test<shortjson::tolerant_dialect>("{'escaped hexadecimal' : '\\x48\\x65\\x6c\\x6c\\x6f\\x20\\x57\\x6f\\x72\\x6c\\x64\\x21\\x20☺'}", "Hello World! ☺");
+    parse_test<shortjson::tolerant_dialect>("{'unpadded octal' : '\\110\\145\\154\\154\\157\\40\\127\\157\\162\\154\\144\\41\\40☺' }", "Hello World! ☺");
+    parse_test<shortjson::tolerant_dialect>("{'padded octal' : '\\110\\145\\154\\154\\157\\040\\127\\157\\162\\154\\144\\041\\040☺' }", "Hello World! ☺");
+
+    parse_test<shortjson::tolerant_dialect>("{'escaped quote' : '\\'quoted\\' \\\"' }", "'quoted' \\\"");
+
+    parse_test<shortjson::tolerant_dialect>("{'signless integer' : 4096 }", 4096);
+    parse_test<shortjson::tolerant_dialect>("{'separated integer' : 4_096 }", 4096);
+    parse_test<shortjson::tolerant_dialect>("{'explicitly positive integer' : +4096 }", 4096);
+    parse_test<shortjson::tolerant_dialect>("{'negative integer' : -4096 }", -4096);
+    parse_test<shortjson::tolerant_dialect>("{'signless hexadecimal integer' : 0x1000 }", 4096);
+    parse_test<shortjson::tolerant_dialect>("{'explicitly positive hexadecimal integer' : +0x1000 }", 4096);
+    parse_test<shortjson::tolerant_dialect>("{'negative hexadecimal integer' : -0x1000 }", -4096);
+
+    parse_test<shortjson::tolerant_dialect>("{'signless float' : 409600000.004096 }", 409600000.004096);
+    parse_test<shortjson::tolerant_dialect>("{'explicitly positive float' : +409600000.004096 }", 409600000.004096);
+    parse_test<shortjson::tolerant_dialect>("{'negative float' : -409600000.004096 }", -409600000.004096);
+
+    parse_test<shortjson::tolerant_dialect>("{'signless scientific large float' : 4.096e+10 }", 40960000000.000000);
+    parse_test<shortjson::tolerant_dialect>("{'signless scientific normal float' : 4.096e+3 }", 4096.000000);
+    parse_test<shortjson::tolerant_dialect>("{'signless scientific small float' : 4.096e-3 }", 0.004096);
+
+    parse_test<shortjson::tolerant_dialect>("{'explicitly positive scientific large float' : +4.096e+10 }",  40960000000.000000);
+    parse_test<shortjson::tolerant_dialect>("{'explicitly positive scientific normal float' : +4.096e+3 }", 4096.000000);
+    parse_test<shortjson::tolerant_dialect>("{'explicitly positive scientific small float' : +4.096e-3 }", 0.004096);
+
+    parse_test<shortjson::tolerant_dialect>("{'negative scientific large float' : -4.096e+10 }", -40960000000.000000);
+    parse_test<shortjson::tolerant_dialect>("{'negative scientific normal float' : -4.096e+3 }", -4096.000000);
+    parse_test<shortjson::tolerant_dialect>("{'negative scientific small float' : -4.096e-3 }", -0.004096);
+
+    parse_test<shortjson::tolerant_dialect>("{'octal integer' : 010 }", 8);
+    parse_test<shortjson::tolerant_dialect>("{'negative octal integer' : -0_10 }", -8);
+    parse_test<shortjson::tolerant_dialect>("{'leading zero integer' : 08 }", 8.0);
+    parse_test<shortjson::tolerant_dialect>("{'leading zero float' : 00.5 }", 0.5);
+    parse_test<shortjson::tolerant_dialect>("{'hexadecimal float' : 0x1p3 }", 8.0);
+    parse_test<shortjson::tolerant_dialect>("{'negative hexadecimal fraction' : -0x1.8 }", -1.5);
+    parse_test<shortjson::tolerant_dialect>("{'infinity' : Infinity }", HUGE_VAL);
+    parse_test<shortjson::tolerant_dialect>("{'negative infinity' : -Infinity }", -HUGE_VAL);
+    parse_test<shortjson::tolerant_dialect>("{'not a number' : NaN }", std::nan(""));
+
+    parser_error_test<shortjson::strict_dialect>("{\"octal integer\" : 010 }", "octal integer");
+    parser_error_test<shortjson::strict_dialect>("{\"hexadecimal float\" : 0x1p3 }", "hexadecimal float");
+    parser_error_test<shortjson::strict_dialect>("{\"infinity\" : Infinity }", "infinity");
+    parser_error_test<shortjson::strict_dialect>("{\"not a number\" : NaN }", "not a number");
+
+    parse_test<separated_dialect>("{\"custom dialect separated integer\" : 4_096 }", 4096);
+    parser_error_test<separated_dialect>("{\"custom dialect apostrophe\" : 'string' }", "custom dialect apostrophe");
+
+    static_float_test();
+    // evaluated at runtime so that the errors are catchable
+    error_test("static missing colon", [] { shortjson::StaticParse<64, 256>("{ \"a\" 1 }"); });
+    error_test("static apostrophe", [] { shortjson::StaticParse<64, 256>("{ \"a\" : 'string' }"); });
+    error_test("static unterminated", [] { shortjson::StaticParse<64, 256>("{ \"a\" : [ 1, 2 "); });
+    error_test("static bad literal", [] { shortjson::StaticParse<64, 256>("{ \"a\" : True }"); });
+    error_test("static overflow", [] { shortjson::StaticParse<64, 256>("{ \"a\" : 9223372036854775808 }"); });
+    error_test("static float overflow", [] { shortjson::StaticParse<64, 256>("{ \"a\" : 1.8e308 }"); });
+
+    patch_test("patch add member", R"({ "foo" : "bar" })", R"([ { "op" : "add", "path" : "/baz", "value" : "qux" } ])", R"({ "baz" : "qux", "foo" : "bar" })");
+    patch_test("patch add element", R"({ "foo" : [ "bar", "baz" ] })", R"([ { "op" : "add", "path" : "/foo/1", "value" : "qux" } ])", R"({ "foo" : [ "bar", "qux", "baz" ] })");
+    patch_test("patch append element", R"({ "foo" : [ 1 ] })", R"([ { "op" : "add", "path" : "/foo/-", "value" : { "a" : 2 } } ])", R"({ "foo" : [ 1, { "a" : 2 } ] })");
+    patch_test("patch remove", R"({ "baz" : "qux", "foo" : [ 1, 2, 3 ] })", R"([ { "op" : "remove", "path" : "/baz" }, { "op" : "remove", "path" : "/foo/1" } ])", R"({ "foo" : [ 1, 3 ] })");
+    patch_test("patch replace", R"({ "baz" : "qux", "foo" : "bar" })", R"([ { "op" : "replace", "path" : "/baz", "value" : 4096 } ])", R"({ "baz" : 4096, "foo" : "bar" })");
+    patch_test("patch move", R"({ "foo" : { "bar" : "baz", "waldo" : "fred" }, "qux" : { "corge" : "grault" } })", R"([ { "op" : "move", "from" : "/foo/waldo", "path" : "/qux/thud" } ])", R"({ "foo" : { "bar" : "baz" }, "qux" : { "corge" : "grault", "thud" : "fred" } })");
+    patch_test("patch copy", R"({ "a" : { "b" : [ true ] } })", R"([ { "op" : "copy", "from" : "/a/b", "path" : "/c" } ])", R"({ "a" : { "b" : [ true ] }, "c" : [ true ] })");
+    patch_test("patch test", R"({ "a" : { "x" : 1, "y" : 2.5 }, "m~n" : null })", R"([ { "op" : "test", "path" : "/a", "value" : { "y" : 2.5, "x" : 1.0 } }, { "op" : "test", "path" : "/m~0n", "value" : null } ])", R"({ "a" : { "x" : 1, "y" : 2.5 }, "m~n" : null })");
+    patch_test("patch whole document", R"({ "a" : 1 })", R"([ { "op" : "replace", "path" : "", "value" : [ 1, 2 ] } ])", R"([ 1, 2 ])");
+    error_test("patch failed test", patching(R"({ "a" : 1 })", R"([ { "op" : "test", "path" : "/a", "value" : 2 } ])"));
+    error_test("patch missing target", patching(R"({ "a" : 1 })", R"([ { "op" : "remove", "path" : "/b" } ])"));
+    error_test("patch index out of bounds", patching(R"({ "a" : [ 1 ] })", R"([ { "op" : "add", "path" : "/a/2", "value" : 2 } ])"));
+    error_test("patch move into child", patching(R"({ "a" : { "b" : 1 } })", R"([ { "op" : "move", "from" : "/a", "path" : "/a/b/c" } ])"));
+    patch_test("merge patch", R"({ "a" : "b", "c" : { "d" : "e", "f" : "g" } })", R"({ "a" : "z", "c" : { "f" : null } })", R"({ "a" : "z", "c" : { "d" : "e" } })", true);
+    patch_test("merge patch new member", R"({ "a" : [ 1 ] })", R"({ "a" : { "b" : null, "c" : 1 }, "d" : [ 2 ] })", R"({ "a" : { "c" : 1 }, "d" : [ 2 ] })", true);
+
+    shared_test();
+    error_test("shared missing path", [] { shortjson::shared_node_t(shortjson::Parse(R"({ "a" : { } })")).with({ "b", "c" }, shortjson::shared_node_t()); });
+    error_test("shared array path", [] { shortjson::shared_node_t(shortjson::Parse(R"({ "a" : [ 1 ] })")).without({ "a", "1" }); });
+
+    const std::string event_log = R"([
+      { "id" : 1, "kind" : "login",  "user" : { "name" : "ann", "age" : 31 }, "tags" : [ "a", { "b" : "}" } ] },
+      { "id" : 2, "kind" : "logout", "user" : { "name" : "bob", "age" : 45 }, "note" : "\"quoted\" ]" },
+      { "id" : 3, "kind" : "login",  "user" : { "name" : "cat", "age" : 17 } },
+      { "id" : 4.5, "user" : { "name" : "dan" } },
+    ])";
+    filter_test("filter projection", event_log, shortjson::filter_t().keep({ "id" }).keep({ "user", "name" }),
+                R"([ { "id" : 1, "user" : { "name" : "ann" } }, { "id" : 2, "user" : { "name" : "bob" } }, { "id" : 3, "user" : { "name" : "cat" } }, { "id" : 4.5, "user" : { "name" : "dan" } } ])");
+    filter_test("filter equal string", event_log, shortjson::filter_t().keep({ "id" }).equal({ "kind" }, "login"),
+                R"([ { "id" : 1 }, { "id" : 3 } ])");
+    filter_test("filter nested range", event_log, shortjson::filter_t().keep({ "id" }).range({ "user", "age" }, 18, 50),
+                R"([ { "id" : 1 }, { "id" : 2 } ])");
+    filter_test("filter equal number", event_log, shortjson::filter_t().keep({ "user" }).equal({ "id" }, 4.5),
+                R"([ { "user" : { "name" : "dan" } } ])");
+    filter_test("filter whole records", event_log, shortjson::filter_t().range({ "user", "name" }, "b", "c"),
+                R"([ { "id" : 2, "kind" : "logout", "user" : { "name" : "bob", "age" : 45 }, "note" : "\"quoted\" ]" } ])");
+    filter_test("filter string range", event_log, shortjson::filter_t().keep({ "id" }).range({ "user", "name" }, "a", "bob"),
+                R"([ { "id" : 1 }, { "id" : 2 } ])");
+    filter_test("filter mixed range", event_log, shortjson::filter_t().keep({ "id" }).range({ "id" }, 2, 4.5),
+                R"([ { "id" : 2 }, { "id" : 3 }, { "id" : 4.5 } ])");
+    filter_test("filter JSON lines", "{ \"a\" : 1, \"b\" : true }\n{ \"a\" : 2, \"b\" : false }\n", shortjson::filter_t().keep({ "a" }).equal({ "b" }, false),
+                R"([ { "a" : 2 } ])");
+
+    equality_test<shortjson::strict_dialect>("equal member order", R"({ "a" : 1, "b" : [ true, null, "x" ], "c" : { "d" : 2.5, "e" : "f" } })", R"({ "c" : { "e" : "f", "d" : 2.5 }, "b" : [ true, null, "x" ], "a" : 1 })", true);
+    equality_test<shortjson::strict_dialect>("equal numbers", R"([ 1, 2.0, -0.0, 409600000.004096 ])", R"([ 1.0, 2, 0, 409600000.004096 ])", true);
+    equality_test<shortjson::strict_dialect>("equal escapes", R"({ "\u0041" : "\u263a" })", R"({ "A" : "☺" })", true);
+    equality_test<shortjson::tolerant_dialect>("equal tolerant", R"({ 'a' : 0x10, "b" : TRUE, })", R"({ "b" : true, "a" : 16 })", true);
+    equality_test<shortjson::strict_dialect>("unequal element order", R"([ 1, 2 ])", R"([ 2, 1 ])", false);
+    equality_test<shortjson::strict_dialect>("unequal member value", R"({ "a" : 1, "b" : 2 })", R"({ "a" : 2, "b" : 1 })", false);
+    equality_test<shortjson::strict_dialect>("unequal member name", R"({ "a" : 1 })", R"({ "b" : 1 })", false);
+    equality_test<shortjson::strict_dialect>("unequal types", R"([ "1", 1, [ ] ])", R"([ 1, "1", { } ])", false);
+    equality_test<shortjson::strict_dialect>("unequal nesting", R"([ [ 1 ], 2 ])", R"([ [ 1, 2 ] ])", false);
+
+    const shortjson::schema_t schema(shortjson::Parse(R"({
+      "type" : "object",
+      "required" : [ "id", "kind" ],
+      "additionalProperties" : false,
+      "properties" : {
+        "id"    : { "type" : "integer", "minimum" : 1 },
+        "kind"  : { "enum" : [ "login", "logout" ] },
+        "name"  : { "type" : "string", "minLength" : 2, "maxLength" : 4 },
+        "ratio" : { "type" : "number", "exclusiveMinimum" : 0, "maximum" : 1 },
+        "tags"  : { "type" : "array", "minItems" : 1, "maxItems" : 2, "items" : { "type" : [ "string", "null" ] } },
+        "owner" : { "type" : "object", "required" : [ "name" ] }
+      }
+    })"));
+    schema_test("schema valid", schema, R"({ "id" : 1, "kind" : "login", "name" : "☺☺☺☺", "ratio" : 1, "tags" : [ "a", null ], "owner" : { "name" : "ann" } })", true);
+    schema_test("schema integral float", schema, R"({ "id" : 2.0, "kind" : "logout" })", true);
+    schema_test("schema wrong type", schema, R"({ "id" : "1", "kind" : "login" })", false);
+    schema_test("schema missing required", schema, R"({ "id" : 1 })", false);
+    schema_test("schema nested required", schema, R"({ "id" : 1, "kind" : "login", "owner" : { } })", false);
+    schema_test("schema additional member", schema, R"({ "id" : 1, "kind" : "login", "extra" : 0 })", false);
+    schema_test("schema enumeration", schema, R"({ "id" : 1, "kind" : "crash" })", false);
+    schema_test("schema minimum", schema, R"({ "id" : 0, "kind" : "login" })", false);
+    schema_test("schema exclusive minimum", schema, R"({ "id" : 1, "kind" : "login", "ratio" : 0 })", false);
+    schema_test("schema maximum", schema, R"({ "id" : 1, "kind" : "login", "ratio" : 1.5 })", false);
+    schema_test("schema short string", schema, R"({ "id" : 1, "kind" : "login", "name" : "a" })", false);
+    schema_test("schema long string", schema, R"({ "id" : 1, "kind" : "login", "name" : "abcde" })", false);
+    schema_test("schema too few items", schema, R"({ "id" : 1, "kind" : "login", "tags" : [ ] })", false);
+    schema_test("schema too many items", schema, R"({ "id" : 1, "kind" : "login", "tags" : [ "a", "b", "c" ] })", false);
+    schema_test("schema item type", schema, R"({ "id" : 1, "kind" : "login", "tags" : [ 1 ] })", false);
+
+    const shortjson::schema_t bounds(shortjson::Parse(R"({ "items" : { "exclusiveMinimum" : 10, "minimum" : 5, "maximum" : 20, "exclusiveMaximum" : 20.5 } })"));
+    schema_test("schema both minimums", bounds, "[ 7 ]", false);
+    schema_test("schema exclusive minimum bound", bounds, "[ 10 ]", false);
+    schema_test("schema within bounds", bounds, "[ 10.5, 20 ]", true);
+    schema_test("schema both maximums", bounds, "[ 20.25 ]", false);
+    error_test("schema boolean bound", [] { shortjson::schema_t(shortjson::Parse(R"({ "minimum" : 0, "exclusiveMinimum" : true })")); });
+    error_test("schema string bound", [] { shortjson::schema_t(shortjson::Parse(R"({ "minimum" : "0" })")); });
+
+    transcode_test<shortjson::strict_dialect>("transcode minify", "{ \"a\" : [ 1, -2.5e+3, true, null ],\n  \"b\" : { \"c\" : \"\\u263a \\\"x\\\"\" }, \"d\" : [ ], }",
+                                              "{\"a\":[1,-2.5e+3,true,null],\"b\":{\"c\":\"\\u263a \\\"x\\\"\"},\"d\":[]}");
+    transcode_test<shortjson::strict_dialect>("transcode escapes", R"({ "a" : "\v\q" })", R"({"a":"\u000b\\q"})");
+    transcode_test<shortjson::tolerant_dialect>("transcode tolerant", R"({ 'a' : 'it\'s "x"', 'b' : [ +0x10, -0X1_0, 1_000, +.5, 5., 1.E2, TRUE, Null ], "c" : '\x41\101', })",
+                                                R"({"a":"it's \"x\"","b":[16,-16,1000,0.5,5.0,1.0e2,true,null],"c":"AA"})");
+    transcode_test<shortjson::tolerant_dialect>("transcode indent", "{ 'a' : [ 1, { } ], 'b' : { 'c' : null } }",
+                                                "{\n  \"a\": [\n    1,\n    {}\n  ],\n  \"b\": {\n    \"c\": null\n  }\n}", 2);
+    transcode_test<shortjson::strict_dialect>("transcode JSON lines", "{ \"a\" : 1 }\n\n[ 2 ]\n", "{\"a\":1}\n[2]");
+    std::string blocks_test = "[", blocks_expected = "[";
+    for(int i = 0; i < 20000; ++i) // larger than a block so that tokens straddle block boundaries
+    {
+      blocks_test += "'tab\\there', 0x10, ";
+      blocks_expected += "\"tab\\there\",16,";
+    }
+    blocks_test += "]";
+    blocks_expected.back() = ']';
+    transcode_test<shortjson::tolerant_dialect>("transcode blocks", blocks_test, blocks_expected);
+    error_test("transcode strict apostrophe", transcoding("{ \"a\" : 'b' }"));
+    error_test("transcode strict positive", transcoding("{ \"a\" : +1 }"));
+    error_test("transcode strict hexadecimal", transcoding("{ \"a\" : 0x10 }"));
+    error_test("transcode strict literal", transcoding("{ \"a\" : True }"));
+    error_test("transcode unterminated", transcoding("{ \"a\" : [ 1 }"));
+    error_test("transcode leading zero fraction", transcoding("[ 00.5 ]"));
+    error_test("transcode leading zero exponent", transcoding("[ 01e5 ]"));
+    error_test("transcode negative leading zero", transcoding("[ -00.1 ]"));
+    error_test("transcode missing comma", transcoding("{ \"a\" : 1 \"b\" : 2 }"));
+    error_test("transcode missing element comma", transcoding("[ 1 2 ]"));
+    error_test("transcode repeated comma", transcoding("[ 1, , 2 ]"));
+    error_test("transcode leading comma", transcoding("[ , 1 ]"));
+    transcode_test<separated_dialect>("transcode custom dialect", "[ 4_096, 1_0.5 ]", "[4096,10.5]");
+    transcode_test<shortjson::tolerant_dialect>("transcode tolerant numbers", "[ 010, -08, 00.5, 0x1p3, -0x.8 ]", "[8,-8.0,0.5,8.0,-0.5]");
+    error_test("transcode infinity", [] { std::ostringstream output; shortjson::Transcode<shortjson::tolerant_dialect>("[ -Infinity ]", output); });
+    error_test("transcode hexadecimal overflow", [] { std::ostringstream output; shortjson::Transcode<shortjson::tolerant_dialect>("[ 0x1_0000_0000_0000_0000 ]", output); });
+    transcode_test<shortjson::tolerant_dialect>("transcode large integers", "[ +99999999999999999999, 1_000_000_000_000_000_000_000 ]",
+                                                "[99999999999999999999,1000000000000000000000]", 0, false);
+    parser_error_test<shortjson::strict_dialect>("{\"leading zero float\" : 00.5 }", "leading zero float");
+    parser_error_test<shortjson::strict_dialect>("{\"integer overflow\" : 99999999999999999999 }", "integer overflow");
   }
   catch(const char* error)
   {